@@ -0,0 +1,189 @@
+/**
+ * @file AhoCorasick.cc
+ * @brief Implementación de la clase AhoCorasick
+ * @author Hector Luis Mariño Fernandez
+ * @date 19 de octubre de 2026
+ */
+
+// Universidad de La Laguna
+// Escuela Superior de Ingeniería y Tecnología
+// Grado en Ingeniería Informática
+// Asignatura: Computabilidad y Algoritmia
+// Curso: 2º
+// Práctica 2: Cadenas y lenguajes
+// Autor: Hector Luis Mariño Fernandez
+// Correo: alu0100595604@ull.edu.es
+// Fecha: 19/10/2026
+// Archivo AhoCorasick.cc: implementación de la clase AhoCorasick.
+// Contiene la construcción del autómata (trie, enlaces de fallo y de
+// salida) y el recorrido de textos para localizar los patrones
+// Referencias:
+// https://en.wikipedia.org/wiki/Aho%E2%80%93Corasick_algorithm
+//
+// Historial de revisiones
+// 19/10/2026 - Creación (primera versión) del código
+
+#include "AhoCorasick.h"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <queue>
+#include <stdexcept>
+
+namespace {
+
+/// Marca de transición todavía no definida durante la construcción del trie;
+/// los estados se indexan con 32 bits, así que nunca es un estado válido
+constexpr uint32_t kUndefined = std::numeric_limits<uint32_t>::max();
+
+}  // namespace
+
+/**
+ * @brief Construye el autómata para el conjunto de patrones dado
+ * Primero inserta los patrones en un trie y después calcula, en anchura, los
+ * enlaces de fallo, completando la tabla de transiciones para que el
+ * recorrido no tenga que retroceder nunca
+ * @param patterns Patrones a buscar; los patrones vacíos se ignoran
+ */
+AhoCorasick::AhoCorasick(const std::vector<std::string>& patterns)
+    : patterns_(patterns) {
+  symbol_index_.fill(kNoSymbol);
+  for (const auto& pattern : patterns_) {
+    for (char c : pattern) {
+      int& index = symbol_index_[static_cast<unsigned char>(c)];
+      if (index == kNoSymbol) {
+        index = static_cast<int>(symbol_count_++);
+      }
+    }
+  }
+
+  // Trie: el estado 0 es el estado inicial
+  transitions_.assign(symbol_count_, kUndefined);
+  outputs_.emplace_back();
+  for (size_t id = 0; id < patterns_.size(); ++id) {
+    if (patterns_[id].empty()) continue;
+    size_t state = 0;
+    for (char c : patterns_[id]) {
+      size_t column = symbol_index_[static_cast<unsigned char>(c)];
+      uint32_t& next = transitions_[state * symbol_count_ + column];
+      if (next == kUndefined) {
+        if (outputs_.size() >= kUndefined) {
+          throw std::runtime_error("Demasiados estados en el autómata de "
+                                   "búsqueda");
+        }
+        next = static_cast<uint32_t>(outputs_.size());
+        outputs_.emplace_back();
+        transitions_.resize(transitions_.size() + symbol_count_, kUndefined);
+      }
+      state = transitions_[state * symbol_count_ + column];
+    }
+    outputs_[state].push_back(id);
+  }
+
+  // Enlaces de fallo en anchura; las transiciones indefinidas se sustituyen
+  // por las del estado de fallo, que ya está completo al ser menos profundo
+  size_t state_count = outputs_.size();
+  std::vector<uint32_t> fail(state_count, 0);
+  output_link_.assign(state_count, 0);
+  std::queue<uint32_t> pending;
+  for (size_t column = 0; column < symbol_count_; ++column) {
+    uint32_t& next = transitions_[column];
+    if (next == kUndefined) {
+      next = 0;
+    } else {
+      pending.push(next);
+    }
+  }
+  while (!pending.empty()) {
+    size_t state = pending.front();
+    pending.pop();
+    uint32_t link = fail[state];
+    output_link_[state] = outputs_[link].empty() ? output_link_[link] : link;
+    for (size_t column = 0; column < symbol_count_; ++column) {
+      uint32_t& next = transitions_[state * symbol_count_ + column];
+      uint32_t fallback = transitions_[link * symbol_count_ + column];
+      if (next == kUndefined) {
+        next = fallback;
+      } else {
+        fail[next] = fallback;
+        pending.push(next);
+      }
+    }
+  }
+}
+
+/**
+ * @brief Busca todas las apariciones de los patrones en un texto
+ * Los símbolos que no aparecen en ningún patrón devuelven el autómata al
+ * estado inicial. En cada posición se recorren los enlaces de salida para
+ * informar de todos los patrones que terminan en ella
+ * @param text Texto en el que buscar
+ * @param matches Vector al que se añaden las apariciones, ordenadas por
+ * posición y, a igual posición, por índice de patrón
+ */
+void AhoCorasick::Search(const std::string& text,
+                         std::vector<Match>& matches) const {
+  if (patterns_.size() == 1) {
+    SearchSingle(text, matches);
+    return;
+  }
+
+  size_t first = matches.size();
+  size_t state = 0;
+  for (size_t i = 0; i < text.length(); ++i) {
+    int column = symbol_index_[static_cast<unsigned char>(text[i])];
+    if (column == kNoSymbol) {
+      state = 0;
+      continue;
+    }
+    state = transitions_[state * symbol_count_ + column];
+    for (size_t out = outputs_[state].empty() ? output_link_[state] : state;
+         out != 0; out = output_link_[out]) {
+      for (size_t id : outputs_[out]) {
+        matches.push_back({i + 1 - patterns_[id].length(), id});
+      }
+    }
+  }
+
+  std::sort(matches.begin() + first, matches.end(),
+            [](const Match& a, const Match& b) {
+              if (a.offset != b.offset) {
+                return a.offset < b.offset;
+              }
+              return a.pattern < b.pattern;
+            });
+}
+
+/**
+ * @brief Búsqueda de un único patrón sin recorrer el autómata
+ * Localiza los candidatos con memchr sobre el primer símbolo del patrón, que
+ * en las bibliotecas estándar habituales está vectorizado, y los confirma con
+ * memcmp
+ * @param text Texto en el que buscar
+ * @param matches Vector al que se añaden las apariciones
+ */
+void AhoCorasick::SearchSingle(const std::string& text,
+                               std::vector<Match>& matches) const {
+  const std::string& pattern = patterns_.front();
+  size_t length = pattern.length();
+  if (length == 0 || length > text.length()) {
+    return;
+  }
+
+  const char* begin = text.data();
+  const char* last = begin + (text.length() - length);
+  const char* cursor = begin;
+  while (cursor <= last) {
+    const void* found =
+        std::memchr(cursor, pattern[0], static_cast<size_t>(last - cursor) + 1);
+    if (found == nullptr) {
+      break;
+    }
+    const char* candidate = static_cast<const char*>(found);
+    if (std::memcmp(candidate + 1, pattern.data() + 1, length - 1) == 0) {
+      matches.push_back({static_cast<size_t>(candidate - begin), 0});
+    }
+    cursor = candidate + 1;
+  }
+}
@@ -0,0 +1,91 @@
+/**
+ * @file AhoCorasick.h
+ * @brief Definición de la clase AhoCorasick para búsqueda de múltiples patrones
+ * @author Hector Luis Mariño Fernandez
+ * @date 19 de octubre de 2026
+ */
+
+// Universidad de La Laguna
+// Escuela Superior de Ingeniería y Tecnología
+// Grado en Ingeniería Informática
+// Asignatura: Computabilidad y Algoritmia
+// Curso: 2º
+// Práctica 2: Cadenas y lenguajes
+// Autor: Hector Luis Mariño Fernandez
+// Correo: alu0100595604@ull.edu.es
+// Fecha: 19/10/2026
+// Archivo AhoCorasick.h: definición de la clase AhoCorasick.
+// Contiene el autómata de Aho-Corasick que localiza todas las apariciones
+// de un conjunto de patrones en una cadena con una sola pasada
+// Referencias:
+// https://en.wikipedia.org/wiki/Aho%E2%80%93Corasick_algorithm
+//
+// Historial de revisiones
+// 19/10/2026 - Creación (primera versión) del código
+
+#ifndef AHOCORASICK_H
+#define AHOCORASICK_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Autómata de Aho-Corasick sobre un conjunto fijo de patrones
+ *
+ * El autómata se construye una única vez y después puede recorrer cualquier
+ * número de textos en tiempo proporcional a su longitud más el número de
+ * apariciones encontradas. Las transiciones se guardan como una tabla densa
+ * indexada por los símbolos que aparecen en los patrones, de modo que cada
+ * símbolo del texto cuesta un único acceso a memoria. Con un solo patrón se
+ * usa en su lugar una búsqueda directa basada en memchr.
+ */
+class AhoCorasick {
+ public:
+  /**
+   * @brief Aparición de un patrón dentro de un texto
+   */
+  struct Match {
+    size_t offset;   ///< Posición (desde 0) del primer símbolo de la aparición
+    size_t pattern;  ///< Índice del patrón en el vector de construcción
+  };
+
+  // ==================== CONSTRUCTORES ====================
+
+  /**
+   * @brief Construye el autómata para el conjunto de patrones dado
+   * @param patterns Patrones a buscar; los patrones vacíos se ignoran
+   */
+  explicit AhoCorasick(const std::vector<std::string>& patterns);
+
+  // ==================== MÉTODOS DE CONSULTA ====================
+
+  /**
+   * @brief Busca todas las apariciones de los patrones en un texto
+   * @param text Texto en el que buscar
+   * @param matches Vector al que se añaden las apariciones, ordenadas por
+   * posición y, a igual posición, por índice de patrón
+   */
+  void Search(const std::string& text, std::vector<Match>& matches) const;
+
+ private:
+  static constexpr int kNoSymbol = -1;  ///< Símbolo ausente en los patrones
+
+  std::vector<std::string> patterns_;  ///< Patrones de construcción
+  std::array<int, 256> symbol_index_;  ///< Byte -> columna de la tabla
+  size_t symbol_count_ = 0;            ///< Columnas de la tabla
+  std::vector<uint32_t> transitions_;  ///< Función de transición completa
+  std::vector<uint32_t> output_link_;  ///< Siguiente estado final por fallo
+  std::vector<std::vector<size_t>> outputs_;  ///< Patrones que acaban aquí
+
+  /**
+   * @brief Búsqueda de un único patrón sin recorrer el autómata
+   * @param text Texto en el que buscar
+   * @param matches Vector al que se añaden las apariciones
+   */
+  void SearchSingle(const std::string& text, std::vector<Match>& matches) const;
+};
+
+#endif
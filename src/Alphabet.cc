@@ -22,9 +22,17 @@
 //
 // Historial de revisiones
 // 21/09/2025 - Creación (primera versión) del código
+// 19/10/2026 - Copias compartidas (Intern) para la representación compacta
+// 19/10/2026 - Enumeración de Σ^k con WordCount, NextWord, Rank y Unrank
 
 #include "Alphabet.h"
 
+#include <iterator>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <stdexcept>
+
 /**
  * @brief Constructor que inicializa el alfabeto con un conjunto de símbolos
  * @param symbols Conjunto de caracteres que formarán el alfabeto
@@ -37,6 +45,21 @@ Alphabet::Alphabet(const std::set<char>& symbols) : symbols_(symbols) {}
  */
 std::set<char> Alphabet::GetSymbols() const { return symbols_; }
 
+/**
+ * @brief Obtiene la copia compartida de un alfabeto
+ * Las copias se guardan en un std::map, cuyos nodos no se mueven al insertar,
+ * por lo que los punteros devueltos siguen siendo válidos
+ * @param alphabet Alfabeto a compartir
+ * @return const Alphabet* Copia compartida con los mismos símbolos
+ */
+const Alphabet* Alphabet::Intern(const Alphabet& alphabet) {
+  static std::mutex mutex;
+  static std::map<std::set<char>, Alphabet> pool;
+
+  std::lock_guard<std::mutex> lock(mutex);
+  return &pool.emplace(alphabet.symbols_, alphabet).first->second;
+}
+
 /**
  * @brief Verifica si un carácter pertenece al alfabeto
  * @param c Carácter a verificar
@@ -46,6 +69,96 @@ bool Alphabet::Contains(char c) const {
   return symbols_.find(c) != symbols_.end();
 }
 
+/**
+ * @brief Obtiene el número de símbolos del alfabeto
+ * @return size_t Cardinal del alfabeto
+ */
+size_t Alphabet::Size() const { return symbols_.size(); }
+
+/**
+ * @brief Calcula el número de palabras de longitud k, |Σ|^k
+ * @param length Longitud k de las palabras
+ * @return uint64_t Número de palabras de longitud k
+ * @throws std::overflow_error si el resultado no cabe en 64 bits
+ */
+uint64_t Alphabet::WordCount(size_t length) const {
+  uint64_t count = 1;
+  uint64_t base = symbols_.size();
+  for (size_t i = 0; i < length; ++i) {
+    if (base != 0 && count > std::numeric_limits<uint64_t>::max() / base) {
+      throw std::overflow_error("Demasiadas palabras de longitud " +
+                                std::to_string(length));
+    }
+    count *= base;
+  }
+  return count;
+}
+
+/**
+ * @brief Avanza una palabra a la siguiente de su longitud, en el sitio
+ * Cada llamada modifica, en promedio, menos de dos símbolos y nunca reserva
+ * memoria
+ * @param word Palabra formada por símbolos del alfabeto
+ * @return false si word era la última de su longitud (queda la primera)
+ */
+bool Alphabet::NextWord(std::string& word) const {
+  for (size_t i = word.length(); i-- > 0;) {
+    auto next = symbols_.upper_bound(word[i]);
+    if (next != symbols_.end()) {
+      word[i] = *next;
+      return true;
+    }
+    word[i] = *symbols_.begin();
+  }
+  return false;
+}
+
+/**
+ * @brief Calcula la posición de una palabra entre las de su longitud
+ * Interpreta la palabra como un número en base |Σ|, con los símbolos como
+ * dígitos en su orden
+ * @param word Palabra formada por símbolos del alfabeto
+ * @return uint64_t Posición (desde 0) de word en orden lexicográfico
+ * @throws std::invalid_argument si word contiene símbolos ajenos
+ * @throws std::overflow_error si la posición no cabe en 64 bits
+ */
+uint64_t Alphabet::Rank(const std::string& word) const {
+  uint64_t rank = 0;
+  for (char c : word) {
+    auto it = symbols_.find(c);
+    if (it == symbols_.end()) {
+      throw std::invalid_argument("Símbolo fuera del alfabeto: " +
+                                  std::string(1, c));
+    }
+    uint64_t base = symbols_.size();
+    uint64_t digit = std::distance(symbols_.begin(), it);
+    if (rank > (std::numeric_limits<uint64_t>::max() - digit) / base) {
+      throw std::overflow_error("Posición fuera de rango para una palabra de "
+                                "longitud " + std::to_string(word.length()));
+    }
+    rank = rank * base + digit;
+  }
+  return rank;
+}
+
+/**
+ * @brief Obtiene la palabra de una posición dada entre las de longitud k
+ * @param index Posición (desde 0) de la palabra, menor que WordCount(k)
+ * @param length Longitud k de la palabra
+ * @param word Cadena donde se escribe la palabra
+ */
+void Alphabet::Unrank(uint64_t index, size_t length, std::string& word) const {
+  word.resize(length);
+  uint64_t base = symbols_.size();
+  if (base == 0) {
+    return;  // Con el alfabeto vacío solo existe la palabra vacía
+  }
+  for (size_t i = length; i-- > 0;) {
+    word[i] = *std::next(symbols_.begin(), index % base);
+    index /= base;
+  }
+}
+
 /**
  * @brief Operador de salida para imprimir el alfabeto
  * Imprime todos los símbolos del alfabeto en formato {a, b, c}
@@ -22,12 +22,17 @@
 //
 // Historial de revisiones
 // 21/09/2025 - Creación (primera versión) del código
+// 19/10/2026 - Copias compartidas (Intern) para la representación compacta
+// 19/10/2026 - Enumeración de Σ^k con WordCount, NextWord, Rank y Unrank
 
 #ifndef ALPHABET_H
 #define ALPHABET_H
 
+#include <cstddef>
+#include <cstdint>
 #include <iostream>
 #include <set>
+#include <string>
 
 /**
  * @brief Clase que representa un alfabeto finito
@@ -62,6 +67,15 @@ class Alphabet {
    */
   std::set<char> GetSymbols() const;
 
+  /**
+   * @brief Obtiene la copia compartida de un alfabeto
+   * Todos los alfabetos con los mismos símbolos comparten una única copia,
+   * que se mantiene hasta el final del programa
+   * @param alphabet Alfabeto a compartir
+   * @return const Alphabet* Copia compartida con los mismos símbolos
+   */
+  static const Alphabet* Intern(const Alphabet& alphabet);
+
   // ==================== MÉTODOS DE CONSULTA ====================
 
   /**
@@ -71,6 +85,50 @@ class Alphabet {
    */
   bool Contains(char c) const;
 
+  /**
+   * @brief Obtiene el número de símbolos del alfabeto
+   * @return size_t Cardinal del alfabeto
+   */
+  size_t Size() const;
+
+  // ==================== ENUMERACIÓN DE PALABRAS ====================
+
+  /**
+   * @brief Calcula el número de palabras de longitud k, |Σ|^k
+   * @param length Longitud k de las palabras
+   * @return uint64_t Número de palabras de longitud k
+   * @throws std::overflow_error si el resultado no cabe en 64 bits
+   */
+  uint64_t WordCount(size_t length) const;
+
+  /**
+   * @brief Avanza una palabra a la siguiente de su longitud, en el sitio
+   * Funciona como un cuentakilómetros: incrementa el último símbolo y, si se
+   * pasa del mayor, lo vuelve al menor y sigue con el anterior
+   * @param word Palabra formada por símbolos del alfabeto
+   * @return false si word era la última de su longitud (queda la primera)
+   */
+  bool NextWord(std::string& word) const;
+
+  /**
+   * @brief Calcula la posición de una palabra entre las de su longitud
+   * @param word Palabra formada por símbolos del alfabeto
+   * @return uint64_t Posición (desde 0) de word en orden lexicográfico
+   * @throws std::invalid_argument si word contiene símbolos ajenos
+   * @throws std::overflow_error si la posición no cabe en 64 bits
+   */
+  uint64_t Rank(const std::string& word) const;
+
+  /**
+   * @brief Obtiene la palabra de una posición dada entre las de longitud k
+   * Es la inversa de Rank y permite empezar la enumeración en cualquier punto
+   * @param index Posición (desde 0) de la palabra, menor que WordCount(k)
+   * @param length Longitud k de la palabra
+   * @param word Cadena donde se escribe la palabra, sin reservar memoria si
+   * ya tiene capacidad suficiente
+   */
+  void Unrank(uint64_t index, size_t length, std::string& word) const;
+
   // ==================== SOBRECARGA DE OPERADORES ====================
 
   /**
@@ -22,24 +22,509 @@
 //
 // Historial de revisiones
 // 21/09/2025 - Creación (primera versión) del código
+// 19/10/2026 - Formato compacto por prefijos compartidos y su expansión
+// 19/10/2026 - Almacenamiento alternativo en tabla hash con orden diferido
+// 19/10/2026 - Volcado a disco con límite de memoria (--memory-limit)
 
 #include "Language.h"
 
+#include <unistd.h>
+
 #include <algorithm>
+#include <cstring>
+#include <queue>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
 #include <vector>
 
+namespace {
+
+/// Bytes estimados por cadena en memoria, además de su contenido
+constexpr size_t kBytesPerString = sizeof(String) + 32;
+
+/// Tramos en disco como máximo; al llegar a este número se mezclan los
+/// kMergeFanIn más pequeños en uno
+constexpr size_t kMaxRuns = 16;
+constexpr size_t kMergeFanIn = 8;
+
+/// Tamaños mínimo y máximo del búfer de cada lector de tramo
+constexpr size_t kMinReaderBuffer = size_t{1} << 12;
+constexpr size_t kMaxReaderBuffer = size_t{1} << 16;
+
+/**
+ * @brief Lector secuencial de un tramo volcado a disco
+ * Cada cadena ocupa una línea (la cadena vacía es una línea vacía). Usa
+ * pread con su propio desplazamiento, de modo que varios recorridos del
+ * mismo tramo no interfieren entre sí
+ */
+class RunReader {
+ public:
+  /**
+   * @brief Crea un lector situado al principio del tramo
+   * @param file Fichero temporal del tramo
+   * @param buffer_size Bytes que se leen del fichero de una vez
+   */
+  RunReader(std::FILE* file, size_t buffer_size)
+      : fd_(fileno(file)), buffer_(buffer_size) {}
+
+  /**
+   * @brief Lee la siguiente cadena del tramo
+   * @param line Cadena leída, sin el salto de línea
+   * @return true si se leyó una cadena, false al final del tramo
+   */
+  bool Next(std::string& line) {
+    line.clear();
+    while (true) {
+      if (position_ == end_) {
+        ssize_t n = pread(fd_, buffer_.data(), buffer_.size(), offset_);
+        if (n <= 0) {
+          return false;
+        }
+        offset_ += n;
+        position_ = 0;
+        end_ = static_cast<size_t>(n);
+      }
+      const char* begin = buffer_.data() + position_;
+      const void* newline = std::memchr(begin, '\n', end_ - position_);
+      if (newline != nullptr) {
+        size_t length = static_cast<const char*>(newline) - begin;
+        line.append(begin, length);
+        position_ += length + 1;
+        return true;
+      }
+      line.append(begin, end_ - position_);
+      position_ = end_;
+    }
+  }
+
+ private:
+  int fd_;                    ///< Descriptor del fichero del tramo
+  off_t offset_ = 0;          ///< Posición de la siguiente lectura
+  std::vector<char> buffer_;  ///< Bloque leído del fichero
+  size_t position_ = 0;       ///< Siguiente byte sin consumir del bloque
+  size_t end_ = 0;            ///< Bytes válidos del bloque
+};
+
+/**
+ * @brief Orden por longitud y, a igual longitud, lexicográfico
+ * @param a Primera cadena
+ * @param b Segunda cadena
+ * @return true si a va antes que b
+ */
+bool ShortlexLess(std::string_view a, std::string_view b) {
+  if (a.length() != b.length()) {
+    return a.length() < b.length();
+  }
+  return a < b;
+}
+
+/**
+ * @brief Mezcla tramos ordenados y cadenas en memoria sin repetir ninguna
+ * Es una mezcla de k vías: un montículo guarda la cadena actual de cada
+ * fuente y en cada paso se avanza la menor. Las cadenas repetidas entre
+ * fuentes salen seguidas y solo se visitan una vez
+ * @param runs Ficheros de los tramos, cada uno ordenado por longitud
+ * @param in_memory Cadenas en memoria, ordenadas por longitud
+ * @param buffer_size Bytes del búfer de cada lector de tramo
+ * @param visit Función a la que se llama con cada cadena, en orden
+ */
+void MergeSources(const std::vector<std::FILE*>& runs,
+                  const std::vector<const String*>& in_memory,
+                  size_t buffer_size,
+                  const std::function<void(const std::string&)>& visit) {
+  // Fuentes de la mezcla: un lector por tramo y, la última, la memoria
+  std::vector<RunReader> readers;
+  readers.reserve(runs.size());
+  for (std::FILE* run : runs) {
+    readers.emplace_back(run, buffer_size);
+  }
+  std::vector<std::string> heads(readers.size() + 1);
+  size_t memory_position = 0;
+  auto advance = [&](size_t source) {
+    if (source < readers.size()) {
+      return readers[source].Next(heads[source]);
+    }
+    if (memory_position == in_memory.size()) {
+      return false;
+    }
+    heads[source] = in_memory[memory_position++]->View();
+    return true;
+  };
+
+  auto later = [&heads](size_t a, size_t b) {
+    return ShortlexLess(heads[b], heads[a]);
+  };
+  std::priority_queue<size_t, std::vector<size_t>, decltype(later)> queue(
+      later);
+  for (size_t source = 0; source < heads.size(); ++source) {
+    if (advance(source)) {
+      queue.push(source);
+    }
+  }
+
+  std::string last;
+  bool first = true;
+  while (!queue.empty()) {
+    size_t source = queue.top();
+    queue.pop();
+    if (first || heads[source] != last) {
+      last = heads[source];
+      visit(last);
+      first = false;
+    }
+    if (advance(source)) {
+      queue.push(source);
+    }
+  }
+}
+
+/**
+ * @brief Crea un fichero temporal para un tramo
+ * El fichero se crea con std::tmpfile, por lo que el sistema lo borra al
+ * cerrarlo, aunque el programa termine de forma anómala
+ * @return std::shared_ptr<std::FILE> Fichero abierto, que se cierra solo
+ * @throws std::runtime_error si no se puede crear el fichero
+ */
+std::shared_ptr<std::FILE> CreateRun() {
+  std::FILE* file = std::tmpfile();
+  if (file == nullptr) {
+    throw std::runtime_error("No se pudo crear un fichero temporal");
+  }
+  return std::shared_ptr<std::FILE>(file, std::fclose);
+}
+
+/**
+ * @brief Añade una cadena al final de un tramo
+ * @param run Fichero del tramo
+ * @param content Cadena a escribir, en su propia línea
+ * @return size_t Bytes escritos
+ */
+size_t WriteToRun(std::FILE* run, std::string_view content) {
+  std::fwrite(content.data(), 1, content.length(), run);
+  std::fputc('\n', run);
+  return content.length() + 1;
+}
+
+/**
+ * @brief Termina de escribir un tramo
+ * @param run Fichero del tramo
+ * @throws std::runtime_error si alguna escritura falló
+ */
+void FinishRun(std::FILE* run) {
+  if (std::fflush(run) != 0 || std::ferror(run)) {
+    throw std::runtime_error("No se pudo escribir un fichero temporal");
+  }
+}
+
+}  // namespace
+
+size_t Language::default_memory_limit_ = 0;
+
+/**
+ * @brief Constructor que crea un lenguaje vacío con la estructura indicada
+ * @param backend Estructura de datos para guardar las cadenas
+ */
+Language::Language(Backend backend) : backend_(backend) {}
+
+/**
+ * @brief Fija el límite de memoria de los lenguajes que se creen después
+ * @param bytes Bytes máximos en memoria por lenguaje, 0 para no limitar
+ */
+void Language::SetDefaultMemoryLimit(size_t bytes) {
+  default_memory_limit_ = bytes;
+}
+
+/**
+ * @brief Fija el límite de memoria de este lenguaje
+ * @param bytes Bytes máximos en memoria, 0 para no limitar
+ */
+void Language::SetMemoryLimit(size_t bytes) { memory_limit_ = bytes; }
+
 /**
  * @brief Añade una cadena al lenguaje
- * Utiliza std::set para garantizar que no haya duplicados
+ * Tanto std::set como StringHashSet garantizan que no haya duplicados
  * @param str Cadena a añadir al lenguaje
  */
-void Language::AddString(const String& str) { strings_.insert(str); }
+void Language::AddString(const String& str) {
+  if (runs_alphabet_ == nullptr) {
+    runs_alphabet_ = str.alphabet_;
+  }
+  bool inserted = backend_ == Backend::kHashed
+                      ? hashed_strings_.Insert(str)
+                      : strings_.insert(str).second;
+  if (inserted) {
+    memory_bytes_ += kBytesPerString + str.Length();
+    if (memory_limit_ != 0 && memory_bytes_ > StringBudget()) {
+      Spill();
+    }
+  }
+}
+
+/**
+ * @brief Comprueba si una cadena pertenece al lenguaje
+ * @param str Cadena a buscar
+ * @return true si la cadena está en el lenguaje
+ */
+bool Language::Contains(const String& str) const {
+  if (backend_ == Backend::kHashed ? hashed_strings_.Contains(str)
+                                   : strings_.count(str) > 0) {
+    return true;
+  }
+  bool found = false;
+  if (!runs_.empty()) {
+    ForEachByLength([&](const String& member) { found |= member == str; });
+  }
+  return found;
+}
+
+/**
+ * @brief Obtiene el número de cadenas del lenguaje
+ * @return size_t Número de cadenas
+ */
+size_t Language::Size() const {
+  if (runs_.empty()) {
+    return backend_ == Backend::kHashed ? hashed_strings_.Size()
+                                        : strings_.size();
+  }
+  size_t count = 0;
+  ForEachByLength([&count](const String&) { ++count; });
+  return count;
+}
 
 /**
  * @brief Obtiene una copia del conjunto de cadenas del lenguaje
+ * Con kHashed el conjunto ordenado se construye en este momento
  * @return std::set<String> Conjunto de cadenas que forman el lenguaje
  */
-std::set<String> Language::GetStrings() const { return strings_; }
+std::set<String> Language::GetStrings() const {
+  if (!runs_.empty()) {
+    std::set<String> all_strings;
+    ForEachByLength([&](const String& str) { all_strings.insert(str); });
+    return all_strings;
+  }
+  if (backend_ == Backend::kHashed) {
+    return std::set<String>(hashed_strings_.Values().begin(),
+                            hashed_strings_.Values().end());
+  }
+  return strings_;
+}
+
+/**
+ * @brief Obtiene las cadenas del lenguaje ordenadas por longitud
+ * A igual longitud, las cadenas se ordenan lexicográficamente
+ * @return std::vector<String> Vector de cadenas ordenadas por longitud
+ */
+std::vector<String> Language::GetStringsByLength() const {
+  if (runs_.empty()) {
+    return SortInMemory();
+  }
+  std::vector<String> sorted_strings;
+  ForEachByLength([&](const String& str) { sorted_strings.push_back(str); });
+  return sorted_strings;
+}
+
+/**
+ * @brief Recorre las cadenas del lenguaje ordenadas por longitud
+ * Con tramos en disco se mezclan los tramos y las cadenas en memoria,
+ * visitando una sola vez las cadenas repetidas entre ellos
+ * @param visit Función a la que se llama con cada cadena, en orden
+ */
+void Language::ForEachByLength(
+    const std::function<void(const String&)>& visit) const {
+  std::vector<const String*> in_memory = SortedInMemory();
+  if (runs_.empty()) {
+    for (const String* str : in_memory) {
+      visit(*str);
+    }
+    return;
+  }
+  std::vector<std::FILE*> files;
+  for (const Run& run : runs_) {
+    files.push_back(run.file.get());
+  }
+  MergeSources(files, in_memory, ReaderBufferSize(),
+               [&](const std::string& content) {
+                 visit(String(content, runs_alphabet_));
+               });
+}
+
+/**
+ * @brief Ordena por longitud las cadenas que están en memoria
+ * @return std::vector<String> Cadenas en memoria ordenadas por longitud
+ */
+std::vector<String> Language::SortInMemory() const {
+  std::vector<String> sorted_strings;
+  for (const String* str : SortedInMemory()) {
+    sorted_strings.push_back(*str);
+  }
+  return sorted_strings;
+}
+
+/**
+ * @brief Ordena por longitud punteros a las cadenas que están en memoria
+ * Evita copiar las cadenas cuando solo hay que recorrerlas en orden
+ * @return std::vector<const String*> Cadenas en memoria ordenadas por
+ * longitud, válidas mientras no se modifique el lenguaje
+ */
+std::vector<const String*> Language::SortedInMemory() const {
+  std::vector<const String*> sorted_strings;
+  if (backend_ == Backend::kHashed) {
+    for (const String& str : hashed_strings_.Values()) {
+      sorted_strings.push_back(&str);
+    }
+  } else {
+    for (const String& str : strings_) {
+      sorted_strings.push_back(&str);
+    }
+  }
+
+  // Ordenar por longitud primero, luego lexicográficamente
+  std::sort(sorted_strings.begin(), sorted_strings.end(),
+            [](const String* a, const String* b) {
+              return ShortlexLess(a->View(), b->View());
+            });
+  return sorted_strings;
+}
+
+/**
+ * @brief Bytes del búfer de cada lector de tramo
+ * Crece con el límite de memoria: entre todos los lectores de una mezcla
+ * ocupan como mucho una cuarta parte del límite (salvo el mínimo de
+ * kMinReaderBuffer por lector)
+ * @return size_t Bytes por lector
+ */
+size_t Language::ReaderBufferSize() const {
+  return std::clamp(memory_limit_ / (4 * kMaxRuns), kMinReaderBuffer,
+                    kMaxReaderBuffer);
+}
+
+/**
+ * @brief Bytes que pueden ocupar las cadenas en memoria antes de volcarlas
+ * Al límite se le descuentan los búferes de los lectores que usa la mezcla,
+ * de modo que recorrer el lenguaje tampoco lo supera
+ * @return size_t Bytes disponibles para las cadenas
+ */
+size_t Language::StringBudget() const {
+  size_t readers = kMaxRuns * ReaderBufferSize();
+  return memory_limit_ > 2 * readers ? memory_limit_ - readers
+                                     : memory_limit_ / 2;
+}
+
+/**
+ * @brief Vuelca las cadenas en memoria, ordenadas, a un fichero temporal
+ * Si con el nuevo tramo se llega a kMaxRuns, se mezclan los más pequeños,
+ * así que nunca hay más de kMaxRuns ficheros abiertos ni lectores a la vez
+ * @throws std::runtime_error si no se puede crear o escribir el fichero
+ */
+void Language::Spill() {
+  Run run{CreateRun(), 0};
+  for (const String* str : SortedInMemory()) {
+    run.bytes += WriteToRun(run.file.get(), str->View());
+  }
+  FinishRun(run.file.get());
+
+  runs_.push_back(run);
+  strings_.clear();
+  hashed_strings_.Clear();
+  memory_bytes_ = 0;
+
+  if (runs_.size() >= kMaxRuns) {
+    CompactRuns();
+  }
+}
+
+/**
+ * @brief Mezcla en uno solo los tramos más pequeños en disco
+ * Mezclar siempre los kMergeFanIn tramos más pequeños hace que los tramos
+ * crezcan por niveles, como en una mezcla de Huffman: cada cadena se
+ * reescribe O(log n) veces en lugar de una vez por cada volcado posterior
+ * @throws std::runtime_error si no se puede crear o escribir el fichero
+ */
+void Language::CompactRuns() {
+  std::sort(runs_.begin(), runs_.end(), [](const Run& a, const Run& b) {
+    return a.bytes < b.bytes;
+  });
+  std::vector<std::FILE*> files;
+  for (size_t i = 0; i < kMergeFanIn; ++i) {
+    files.push_back(runs_[i].file.get());
+  }
+
+  Run merged{CreateRun(), 0};
+  MergeSources(files, {}, ReaderBufferSize(),
+               [&merged](const std::string& content) {
+                 merged.bytes += WriteToRun(merged.file.get(), content);
+               });
+  FinishRun(merged.file.get());
+  runs_.erase(runs_.begin(), runs_.begin() + kMergeFanIn);
+  runs_.push_back(merged);
+}
+
+/**
+ * @brief Escribe el lenguaje en formato compacto por prefijos compartidos
+ * En orden por longitud las cadenas consecutivas suelen compartir un prefijo
+ * largo (prefijos de una cadena, por ejemplo), que solo se escribe una vez
+ * @param os Flujo de salida
+ */
+void Language::WriteFrontCoded(std::ostream& os) const {
+  std::string previous;
+  bool first = true;
+  ForEachByLength([&](const String& str) {
+    std::string_view current = str.View();
+    size_t lcp = 0;
+    size_t limit = std::min(previous.length(), current.length());
+    while (lcp < limit && previous[lcp] == current[lcp]) {
+      ++lcp;
+    }
+    if (!first) {
+      os << ' ';
+    }
+    os << lcp << ':';
+    os.write(current.data() + lcp, current.length() - lcp);
+    previous.assign(current);
+    first = false;
+  });
+}
+
+/**
+ * @brief Expande una línea en formato compacto al formato {...} habitual
+ * Reconstruye cada cadena a partir de la anterior y la escribe igual que lo
+ * haría el operador de salida
+ * @param line Línea escrita por WriteFrontCoded
+ * @param os Flujo de salida donde escribir el lenguaje expandido
+ * @throws std::runtime_error si la línea no tiene el formato esperado
+ */
+void Language::ExpandFrontCoded(const std::string& line, std::ostream& os) {
+  std::istringstream tokens(line);
+  std::string token;
+  std::string current;
+  bool first = true;
+
+  os << "{";
+  while (tokens >> token) {
+    size_t colon = token.find(':');
+    size_t lcp = 0;
+    if (colon == 0 || colon == std::string::npos ||
+        token.find_first_not_of("0123456789") != colon ||
+        (lcp = std::stoul(token.substr(0, colon))) > current.length()) {
+      throw std::runtime_error("Entrada en formato compacto incorrecta: " +
+                               token);
+    }
+    current.erase(lcp);
+    current.append(token, colon + 1, std::string::npos);
+    if (!first) {
+      os << ", ";
+    }
+    if (current.empty()) {
+      os << "&";
+    } else {
+      os << current;
+    }
+    first = false;
+  }
+  os << "}";
+}
 
 /**
  * @brief Operador de salida para imprimir el lenguaje
@@ -51,29 +536,15 @@ std::set<String> Language::GetStrings() const { return strings_; }
  * @return std::ostream& Referencia al flujo de salida
  */
 std::ostream& operator<<(std::ostream& os, const Language& lang) {
-  // Convertir el set a vector para poder ordenarlo por longitud
-  std::vector<String> sorted_strings(lang.strings_.begin(),
-                                     lang.strings_.end());
-
-  // Ordenar por longitud primero, luego lexicográficamente
-  std::sort(
-      sorted_strings.begin(), sorted_strings.end(),
-      [](const String& a, const String& b) {
-        if (a.Length() != b.Length()) {
-          return a.Length() < b.Length();  // Ordenar por longitud
-        }
-        return a < b;  // Si tienen la misma longitud, ordenar lexicográficamente
-      });
-
   os << "{";
   bool first = true;
-  for (const auto& str : sorted_strings) {
+  lang.ForEachByLength([&](const String& str) {
     if (!first) {
       os << ", ";
     }
     os << str;
     first = false;
-  }
+  });
   os << "}";
   return os;
 }
@@ -22,17 +22,24 @@
 //
 // Historial de revisiones
 // 21/09/2025 - Creación (primera versión) del código
+// 19/10/2026 - Formato compacto por prefijos compartidos y su expansión
+// 19/10/2026 - Almacenamiento alternativo en tabla hash con orden diferido
+// 19/10/2026 - Volcado a disco con límite de memoria (--memory-limit)
 
 #ifndef LANGUAGE_H
 #define LANGUAGE_H
 
 #include <algorithm>
 #include <cstddef>
+#include <cstdio>
+#include <functional>
 #include <iostream>
+#include <memory>
 #include <set>
 #include <vector>
 
 #include "String.h"
+#include "StringHashSet.h"
 
 /**
  * @brief Clase que representa un lenguaje formal como conjunto de cadenas
@@ -42,8 +49,72 @@
  * utilizadas en teoría de autómatas y lenguajes formales.
  */
 class Language {
+ public:
+  /**
+   * @brief Estructura de datos con la que se guardan las cadenas
+   *
+   * kOrdered mantiene las cadenas ordenadas en todo momento (std::set).
+   * kHashed usa una tabla hash, con inserción y pertenencia en tiempo
+   * constante, y solo ordena las cadenas cuando se piden en orden o se
+   * imprime el lenguaje.
+   */
+  enum class Backend { kOrdered, kHashed };
+
  private:
+  Backend backend_ = Backend::kOrdered;  ///< Estructura elegida
   std::set<String> strings_;  ///< Conjunto de cadenas que forman el lenguaje
+  StringHashSet hashed_strings_;  ///< Cadenas del lenguaje con kHashed
+
+  static size_t default_memory_limit_;  ///< Límite de los nuevos lenguajes
+  size_t memory_limit_ = default_memory_limit_;  ///< Bytes en memoria, 0 = ∞
+  size_t memory_bytes_ = 0;  ///< Estimación de los bytes ocupados en memoria
+  /**
+   * @brief Tramo de cadenas ordenadas volcado a un fichero temporal
+   */
+  struct Run {
+    std::shared_ptr<std::FILE> file;  ///< Fichero, que se cierra solo
+    size_t bytes = 0;                 ///< Bytes escritos en el fichero
+  };
+
+  std::vector<Run> runs_;  ///< Tramos volcados a disco
+  const Alphabet* runs_alphabet_ = nullptr;  ///< Alfabeto de los tramos
+
+  /**
+   * @brief Ordena por longitud las cadenas que están en memoria
+   * @return std::vector<String> Cadenas en memoria ordenadas por longitud
+   */
+  std::vector<String> SortInMemory() const;
+
+  /**
+   * @brief Ordena por longitud punteros a las cadenas que están en memoria
+   * @return std::vector<const String*> Cadenas en memoria ordenadas por
+   * longitud, válidas mientras no se modifique el lenguaje
+   */
+  std::vector<const String*> SortedInMemory() const;
+
+  /**
+   * @brief Bytes del búfer de cada lector de tramo
+   * @return size_t Bytes por lector
+   */
+  size_t ReaderBufferSize() const;
+
+  /**
+   * @brief Bytes que pueden ocupar las cadenas en memoria antes de volcarlas
+   * @return size_t Bytes disponibles para las cadenas
+   */
+  size_t StringBudget() const;
+
+  /**
+   * @brief Vuelca las cadenas en memoria, ordenadas, a un fichero temporal
+   * @throws std::runtime_error si no se puede crear o escribir el fichero
+   */
+  void Spill();
+
+  /**
+   * @brief Mezcla en uno solo los tramos más pequeños en disco
+   * @throws std::runtime_error si no se puede crear o escribir el fichero
+   */
+  void CompactRuns();
 
  public:
   // ==================== CONSTRUCTORES ====================
@@ -53,6 +124,35 @@ class Language {
    */
   Language() = default;
 
+  /**
+   * @brief Constructor que crea un lenguaje vacío con la estructura indicada
+   * @param backend Estructura de datos para guardar las cadenas
+   */
+  explicit Language(Backend backend);
+
+  // ==================== LÍMITE DE MEMORIA ====================
+
+  /**
+   * @brief Fija el límite de memoria de los lenguajes que se creen después
+   * @param bytes Bytes máximos en memoria por lenguaje, 0 para no limitar
+   */
+  static void SetDefaultMemoryLimit(size_t bytes);
+
+  /**
+   * @brief Fija el límite de memoria de este lenguaje
+   *
+   * Cuando las cadenas en memoria superan el límite se vuelcan, ordenadas,
+   * a un fichero temporal y se liberan. Al recorrer el lenguaje en orden se
+   * mezclan todos los tramos eliminando duplicados, por lo que el resultado
+   * es el mismo que sin límite. Los búferes de lectura de la mezcla cuentan
+   * dentro del límite, y cuando hay demasiados tramos se mezclan en uno solo
+   * en disco, de modo que el número de ficheros abiertos está acotado.
+   * Size(), Contains() y GetStrings() siguen funcionando, pero tienen que
+   * leer los tramos volcados.
+   * @param bytes Bytes máximos en memoria, 0 para no limitar
+   */
+  void SetMemoryLimit(size_t bytes);
+
   // ==================== MÉTODOS DE MODIFICACIÓN ====================
 
   /**
@@ -61,6 +161,26 @@ class Language {
    */
   void AddString(const String& str);
 
+  // ==================== MÉTODOS DE CONSULTA ====================
+
+  /**
+   * @brief Comprueba si una cadena pertenece al lenguaje
+   * Si hay tramos volcados a disco y la cadena no está en memoria, cada
+   * llamada vuelve a mezclar y leer todos los tramos: O(tamaño del lenguaje)
+   * @param str Cadena a buscar
+   * @return true si la cadena está en el lenguaje
+   */
+  bool Contains(const String& str) const;
+
+  /**
+   * @brief Obtiene el número de cadenas del lenguaje
+   * Si hay tramos volcados a disco, cada llamada vuelve a mezclar y leer
+   * todos los tramos (una cadena puede estar repetida en varios), con coste
+   * O(tamaño del lenguaje)
+   * @return size_t Número de cadenas
+   */
+  size_t Size() const;
+
   // ==================== MÉTODOS DE ACCESO ====================
 
   /**
@@ -75,6 +195,35 @@ class Language {
    */
   std::vector<String> GetStringsByLength() const;
 
+  /**
+   * @brief Recorre las cadenas del lenguaje ordenadas por longitud
+   * No necesita tener todo el lenguaje en memoria: si hay tramos volcados a
+   * disco se mezclan sobre la marcha
+   * @param visit Función a la que se llama con cada cadena, en orden
+   */
+  void ForEachByLength(const std::function<void(const String&)>& visit) const;
+
+  // ==================== FORMATO COMPACTO ====================
+
+  /**
+   * @brief Escribe el lenguaje en formato compacto por prefijos compartidos
+   *
+   * Las cadenas se escriben en orden por longitud y lexicográfico, separadas
+   * por espacios, como "lcp:sufijo", donde lcp es la longitud del prefijo
+   * común con la cadena anterior y sufijo el resto de la cadena. Por ejemplo
+   * {&, b, be, ber} se escribe "0: 0:b 1:e 2:r".
+   * @param os Flujo de salida
+   */
+  void WriteFrontCoded(std::ostream& os) const;
+
+  /**
+   * @brief Expande una línea en formato compacto al formato {...} habitual
+   * @param line Línea escrita por WriteFrontCoded
+   * @param os Flujo de salida donde escribir el lenguaje expandido
+   * @throws std::runtime_error si la línea no tiene el formato esperado
+   */
+  static void ExpandFrontCoded(const std::string& line, std::ostream& os);
+
   // ==================== SOBRECARGA DE OPERADORES ====================
 
   /**
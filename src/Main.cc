@@ -26,15 +26,33 @@
 //
 // Historial de revisiones
 // 21/09/2025 - Creación (primera versión) del código
+// 19/10/2026 - Opcodes 7 a 10 de análisis de cadenas
+// 19/10/2026 - Opcode 11 de búsqueda de varios patrones (Aho-Corasick)
+// 19/10/2026 - Opcode 12 de consultas de subsecuencias
+// 19/10/2026 - Opción --compacto y opcode 13 de expansión
+// 19/10/2026 - Modo servidor sobre un socket Unix (--servidor)
+// 19/10/2026 - Opcodes 14 y 15 de enumeración de Σ^k
+// 19/10/2026 - Opción --memory-limit
+// 19/10/2026 - Opcodes 16 y 17 de distancia de edición y LCS (--referencia)
+// 19/10/2026 - Opcodes 18 y 19 con el autómata de sufijos del lote
+// 19/10/2026 - Opciones --min-len, --max-len y --len
+// 19/10/2026 - Opcode 20 de uso del alfabeto
 
+#include <cctype>
 #include <fstream>
 #include <iostream>
+#include <optional>
 #include <sstream>
 #include <vector>
 
+#include "AhoCorasick.h"
 #include "Alphabet.h"
 #include "Language.h"
+#include "Operations.h"
+#include "Server.h"
 #include "String.h"
+#include "SubsequenceIndex.h"
+#include "SuffixAutomaton.h"
 
 /**
  * @brief Lee los datos de entrada desde un archivo
@@ -95,12 +113,282 @@ std::vector<String> ReadInputFile(const std::string& filename) {
   return strings;
 }
 
+/**
+ * @brief Lee los patrones de búsqueda desde un archivo
+ * @param filename Nombre del archivo de patrones
+ * @return std::vector<std::string> Patrones leídos, en el orden del archivo
+ * @throws std::runtime_error si no se puede abrir el archivo
+ *
+ * Formato esperado del archivo: un patrón por línea. Las líneas vacías se
+ * ignoran y no cuentan para la numeración de los patrones.
+ */
+std::vector<std::string> ReadPatternFile(const std::string& filename) {
+  std::ifstream file(filename);
+  if (!file.is_open()) {
+    throw std::runtime_error("No se pudo abrir el archivo: " + filename);
+  }
+
+  std::vector<std::string> patterns;
+  std::string line;
+  while (std::getline(file, line)) {
+    if (!line.empty() && line.back() == '\r') line.pop_back();
+    if (line.empty()) continue;  // Saltar líneas vacías
+    patterns.push_back(line);
+  }
+  return patterns;
+}
+
+/**
+ * @brief Opciones de ejecución leídas de la línea de comandos
+ */
+struct Options {
+  std::string input_filename;   ///< Archivo de entrada
+  std::string output_filename;  ///< Archivo de salida
+  int opcode = 0;               ///< Código de operación a realizar
+  std::string argument;         ///< Argumento adicional que necesita el opcode
+  bool compact = false;         ///< Lenguajes en formato compacto (--compacto)
+  std::string socket_path;      ///< Socket del modo servidor (--servidor=)
+  size_t memory_limit = 0;      ///< Bytes por lenguaje (--memory-limit=)
+  size_t reference = 0;         ///< Línea de referencia (--referencia=), 0 = no
+  size_t min_length = 0;        ///< Longitud mínima (--min-len=, --len=)
+  size_t max_length = String::kNoMaxLength;  ///< Máxima (--max-len=, --len=)
+  size_t word_length = 0;       ///< k de los opcodes 14 y 15
+};
+
+/**
+ * @brief Interpreta una cantidad de memoria como 512, 64K, 256M o 2G
+ * @param text Cantidad con sufijo opcional K, M o G (potencias de 1024)
+ * @param bytes Bytes correspondientes a la cantidad
+ * @return true si la cantidad es correcta, false en caso contrario
+ */
+bool ParseMemorySize(const std::string& text, size_t& bytes) {
+  size_t digits = 0;
+  while (digits < text.length() && std::isdigit(text[digits])) {
+    ++digits;
+  }
+  if (digits == 0 || text.length() - digits > 1) {
+    return false;
+  }
+  try {
+    bytes = std::stoull(text.substr(0, digits));
+  } catch (const std::out_of_range&) {
+    return false;
+  }
+  if (digits < text.length()) {
+    switch (std::toupper(text[digits])) {
+      case 'G':
+        bytes <<= 10;
+        [[fallthrough]];
+      case 'M':
+        bytes <<= 10;
+        [[fallthrough]];
+      case 'K':
+        bytes <<= 10;
+        break;
+      default:
+        return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * @brief Interpreta un número natural, como la k de --len=3 o del opcode 14
+ * @param text Texto con el número, solo dígitos
+ * @param value Número leído
+ * @return true si el texto es un número natural, false en caso contrario
+ */
+bool ParseNatural(const std::string& text, size_t& value) {
+  if (text.empty() ||
+      text.find_first_not_of("0123456789") != std::string::npos) {
+    return false;
+  }
+  try {
+    value = std::stoull(text);
+  } catch (const std::out_of_range&) {
+    return false;
+  }
+  return true;
+}
+
+/**
+ * @brief Interpreta los argumentos de la línea de comandos
+ * Los argumentos que empiezan por "--" son opciones y pueden aparecer en
+ * cualquier posición; el resto son, por orden, entrada, salida, opcode y el
+ * fichero adicional. En modo servidor no hay argumentos posicionales
+ * @param argc Número de argumentos de línea de comandos
+ * @param argv Array de argumentos de línea de comandos
+ * @param options Estructura donde se guardan las opciones leídas
+ * @return true si los argumentos son correctos, false en caso contrario
+ */
+bool ParseArguments(int argc, char* argv[], Options& options) {
+  std::vector<std::string> positional;
+  for (int i = 1; i < argc; ++i) {
+    std::string arg = argv[i];
+    std::string value = arg.substr(arg.find('=') + 1);  // Valor tras el '='
+    if (arg == "--compacto") {
+      options.compact = true;
+    } else if (arg.rfind("--memory-limit=", 0) == 0) {
+      std::string size = arg.substr(std::string("--memory-limit=").length());
+      if (!ParseMemorySize(size, options.memory_limit)) return false;
+    } else if (arg.rfind("--referencia=", 0) == 0) {
+      if (!ParseNatural(value, options.reference)) return false;
+      if (options.reference == 0) return false;
+    } else if (arg.rfind("--min-len=", 0) == 0) {
+      if (!ParseNatural(value, options.min_length)) return false;
+    } else if (arg.rfind("--max-len=", 0) == 0) {
+      if (!ParseNatural(value, options.max_length)) return false;
+    } else if (arg.rfind("--len=", 0) == 0) {
+      if (!ParseNatural(value, options.min_length)) return false;
+      options.max_length = options.min_length;
+    } else if (arg.rfind("--servidor=", 0) == 0) {
+      options.socket_path = arg.substr(std::string("--servidor=").length());
+      if (options.socket_path.empty()) return false;
+    } else if (arg.rfind("--", 0) == 0) {
+      std::cerr << "Error: Opción desconocida: " << arg << std::endl;
+      return false;
+    } else {
+      positional.push_back(arg);
+    }
+  }
+
+  if (!options.socket_path.empty()) {
+    return positional.empty();
+  }
+  if (positional.size() != 3 && positional.size() != 4) {
+    return false;
+  }
+  options.input_filename = positional[0];
+  options.output_filename = positional[1];
+  try {
+    options.opcode = std::stoi(positional[2]);
+  } catch (const std::exception&) {
+    return false;
+  }
+  if (positional.size() == 4) {
+    options.argument = positional[3];
+  }
+
+  if (options.min_length > options.max_length) {
+    return false;
+  }
+
+  // Opcodes que necesitan un argumento adicional (fichero o longitud)
+  bool needs_argument = options.opcode == 11 || options.opcode == 12 ||
+                        options.opcode == 14 || options.opcode == 15 ||
+                        options.opcode == 18;
+  if (needs_argument == options.argument.empty()) {
+    return false;
+  }
+
+  // Solo las comparaciones entre líneas admiten una línea de referencia
+  bool uses_reference = options.opcode == 16 || options.opcode == 17 ||
+                        options.opcode == 19;
+  if (options.reference != 0 && !uses_reference) {
+    std::cerr << "Error: --referencia solo se admite con los opcodes 16, 17 "
+              << "y 19" << std::endl;
+    return false;
+  }
+
+  // Solo los lenguajes de prefijos, sufijos y subsecuencias admiten el
+  // formato compacto y un rango de longitudes
+  bool writes_language = options.opcode >= 4 && options.opcode <= 6;
+  if (options.compact && !writes_language) {
+    std::cerr << "Error: --compacto solo se admite con los opcodes 4, 5 y 6"
+              << std::endl;
+    return false;
+  }
+  bool bounded = options.min_length != 0 ||
+                 options.max_length != String::kNoMaxLength;
+  if (bounded && !writes_language) {
+    std::cerr << "Error: --min-len, --max-len y --len solo se admiten con los "
+              << "opcodes 4, 5 y 6" << std::endl;
+    return false;
+  }
+
+  // Longitud de las palabras generadas por los opcodes 14 y 15
+  if (options.opcode == 14 || options.opcode == 15) {
+    return ParseNatural(options.argument, options.word_length);
+  }
+  return true;
+}
+
+/**
+ * @brief Expande un archivo en formato compacto al formato {...} habitual
+ * @param input_filename Archivo escrito con la opción --compacto
+ * @param output Flujo donde escribir los lenguajes expandidos
+ * @throws std::runtime_error si no se puede abrir el archivo o una línea no
+ * tiene el formato compacto
+ */
+void ExpandFrontCodedFile(const std::string& input_filename,
+                          std::ostream& output) {
+  std::ifstream file(input_filename);
+  if (!file.is_open()) {
+    throw std::runtime_error("No se pudo abrir el archivo: " + input_filename);
+  }
+
+  std::string line;
+  while (std::getline(file, line)) {
+    Language::ExpandFrontCoded(line, output);
+    output << "\n";
+  }
+}
+
+/**
+ * @brief Escribe el resultado de una operación que trabaja sobre todo el lote
+ * Estas operaciones comparan o indexan todas las cadenas a la vez, en lugar
+ * de escribir una línea por cadena
+ * @param os Flujo de salida
+ * @param strings Cadenas del lote
+ * @param options Opciones de ejecución (opcode, referencia y argumento)
+ * @return true si el opcode es una operación sobre el lote, false si no lo es
+ */
+bool WriteBatchOperation(std::ostream& os, const std::vector<String>& strings,
+                         const Options& options) {
+  // main ya comprobó que la línea de referencia existe
+  size_t reference =
+      options.reference == 0 ? strings.size() : options.reference - 1;
+
+  switch (options.opcode) {
+    case 16:
+      // Mostrar las distancias de edición
+      WriteComparison(os, strings, &String::EditDistance, false, reference);
+      return true;
+    case 17:
+      // Mostrar las longitudes de la subsecuencia común más larga
+      WriteComparison(os, strings, &String::LcsLength, true, reference);
+      return true;
+
+    case 18: {
+      // Mostrar las líneas que contienen cada subcadena consultada
+      std::vector<std::string> queries = ReadPatternFile(options.argument);
+      WriteSubstringQueries(os, SuffixAutomaton(strings), queries);
+      return true;
+    }
+    case 19:
+      // Mostrar la subcadena común más larga entre líneas
+      WriteCommonSubstrings(os, SuffixAutomaton(strings), strings.size(),
+                            reference);
+      return true;
+
+    case 20:
+      // Mostrar la frecuencia de símbolos frente a cada alfabeto
+      WriteSymbolUsage(os, strings);
+      return true;
+
+    default:
+      return false;
+  }
+}
+
 /**
  * @brief Muestra el modo de uso correcto del programa
  * @param program_name Nombre del programa (argv[0])
  */
 void Usage(const std::string& program_name) {
-  std::cout << "Usage: " << program_name << " input.txt output.txt opcode\n";
+  std::cout << "Usage: " << program_name
+            << " input.txt output.txt opcode [argumento] [--compacto]\n";
+  std::cout << "       " << program_name << " --servidor=ruta.sock\n";
   std::cout << "Opcodes:\n";
   std::cout << " 1: alfabeto\n";
   std::cout << " 2: longitud\n";
@@ -108,6 +396,29 @@ void Usage(const std::string& program_name) {
   std::cout << " 4: prefijos\n";
   std::cout << " 5: sufijos\n";
   std::cout << " 6: subsecuencias\n";
+  std::cout << " 7: palíndromo más largo\n";
+  std::cout << " 8: subcadena repetida más larga\n";
+  std::cout << " 9: periodo mínimo\n";
+  std::cout << " 10: array de bordes\n";
+  std::cout << " 11: búsqueda de patrones (fichero de patrones)\n";
+  std::cout << " 12: consultas de subsecuencias (fichero de consultas)\n";
+  std::cout << " 13: expandir una salida en formato compacto\n";
+  std::cout << " 14: palabras de longitud k del alfabeto (argumento k)\n";
+  std::cout << " 15: palabras de longitud hasta k del alfabeto (argumento k)\n";
+  std::cout << " 16: distancia de edición entre cadenas\n";
+  std::cout << " 17: longitud de la subsecuencia común más larga\n";
+  std::cout << " 18: líneas que contienen cada subcadena (fichero de "
+            << "consultas)\n";
+  std::cout << " 19: subcadena común más larga entre líneas\n";
+  std::cout << " 20: frecuencia de símbolos y uso del alfabeto\n";
+  std::cout << "Opciones:\n";
+  std::cout << " --compacto: opcodes 4-6 en formato compacto\n";
+  std::cout << " --servidor=ruta: atender opcodes 1-10 en un socket Unix\n";
+  std::cout << " --min-len=N, --max-len=N, --len=N: opcodes 4-6 solo con\n"
+            << "   palabras de longitud en el rango\n";
+  std::cout << " --referencia=N: opcodes 16, 17 y 19 solo contra la línea N\n";
+  std::cout << " --memory-limit=N[K|M|G]: volcar a disco los lenguajes que\n"
+            << "   superen N bytes en memoria\n";
 }
 
 /**
@@ -117,19 +428,50 @@ void Usage(const std::string& program_name) {
  * @return int Código de salida (0 si éxito, 1 si error)
  */
 int main(int argc, char* argv[]) {
-  // Verificar número correcto de argumentos
-  if (argc != 4) {
+  Options options;
+  if (!ParseArguments(argc, argv, options)) {
     Usage(argv[0]);
     return 1;
   }
 
-  std::string input_filename = argv[1];
-  std::string output_filename = argv[2];
-  int opcode = std::stoi(argv[3]);  // Código de operación a realizar
+  Language::SetDefaultMemoryLimit(options.memory_limit);
+
+  if (!options.socket_path.empty()) {
+    try {
+      Server(options.socket_path).Run();
+    } catch (const std::exception& e) {
+      std::cerr << "Error: " << e.what() << std::endl;
+      return 1;
+    }
+    return 0;
+  }
+
+  const std::string& input_filename = options.input_filename;
+  const std::string& output_filename = options.output_filename;
+  int opcode = options.opcode;
+  const std::string& argument = options.argument;
 
   try {
-    // Leer datos del archivo de entrada
-    std::vector<String> strings = ReadInputFile(input_filename);
+    // Leer datos del archivo de entrada; la expansión del formato compacto
+    // (opcode 13) no trabaja sobre cadenas
+    std::vector<String> strings;
+    if (opcode != 13) {
+      strings = ReadInputFile(input_filename);
+    }
+
+    // Σ^k puede no caber en 64 bits; se comprueba antes de escribir nada
+    if (opcode == 14 || opcode == 15) {
+      for (const String& str : strings) {
+        str.GetAlphabet().WordCount(options.word_length);
+      }
+    }
+
+    // La línea de referencia (solo en los opcodes 16, 17 y 19, según
+    // ParseArguments) debe existir en la entrada
+    if (options.reference > strings.size()) {
+      throw std::runtime_error("La línea de referencia no existe: " +
+                               std::to_string(options.reference));
+    }
 
     // Abrir archivo de salida
     std::ofstream output(output_filename);
@@ -139,43 +481,77 @@ int main(int argc, char* argv[]) {
       return 1;
     }
 
+    if (opcode == 13) {
+      ExpandFrontCodedFile(input_filename, output);
+      std::cout << "Procesamiento completado. Resultados guardados en: "
+                << output_filename << std::endl;
+      return 0;
+    }
+
     // Mostrar información de las cadenas leídas
     std::cout << "Número de cadenas leídas: " << strings.size() << std::endl;
 
+    // El autómata de búsqueda se construye una sola vez para todo el lote
+    std::optional<AhoCorasick> searcher;
+    if (opcode == 11) {
+      searcher.emplace(ReadPatternFile(argument));
+    }
+    std::vector<AhoCorasick::Match> matches;
+
+    // Las consultas de subsecuencias se leen una vez y se aplican a cada cadena
+    std::vector<std::string> queries;
+    if (opcode == 12) {
+      queries = ReadPatternFile(argument);
+    }
+
+    // Las operaciones sobre todo el lote a la vez no pasan por el bucle
+    bool batch = WriteBatchOperation(output, strings, options);
+
     // Procesar cada cadena según el código de operación
-    for (size_t i = 0; i < strings.size(); ++i) {
+    for (size_t i = 0; !batch && i < strings.size(); ++i) {
       const String& str = strings[i];
 
       switch (opcode) {
-        case 1:
-          // Mostrar alfabeto de la cadena
-          output << str.GetAlphabet() << std::endl;
+        case 11:
+          // Mostrar cada aparición como: línea desplazamiento patrón
+          matches.clear();
+          searcher->Search(str.GetContent(), matches);
+          for (const auto& match : matches) {
+            output << i + 1 << " " << match.offset << " " << match.pattern + 1
+                   << "\n";
+          }
           break;
-        case 2:
-          // Mostrar longitud de la cadena
-          output << str.Length() << std::endl;
-          break;
-        case 3:
-          // Mostrar cadena inversa
-          output << str.Reverse() << std::endl;
-          break;
-        case 4:
-          // Mostrar prefijos de la cadena
-          output << str.Prefixes() << std::endl;
-          break;
-        case 5:
-          // Mostrar sufijos de la cadena
-          output << str.Suffixes() << std::endl;
+
+        case 12: {
+          // Mostrar 1 o 0 por consulta según sea subsecuencia de la cadena
+          std::vector<char> answers =
+              str.IndexSubsequences().AreSubsequences(queries);
+          for (size_t j = 0; j < answers.size(); ++j) {
+            output << (j > 0 ? " " : "") << static_cast<int>(answers[j]);
+          }
+          output << "\n";
           break;
+        }
 
-        case 6:
-          output << str.Subsequences() << std::endl;
+        case 14:
+          // Mostrar Σ^k sobre el alfabeto de la cadena
+          WriteWords(output, str.GetAlphabet(), options.word_length,
+                     options.word_length);
+          break;
+        case 15:
+          // Mostrar Σ^{<=k} sobre el alfabeto de la cadena
+          WriteWords(output, str.GetAlphabet(), 0, options.word_length);
           break;
 
         default:
-          // Código de operación inválido
-          Usage(argv[0]);
-          return 1;
+          // Operaciones que solo dependen de la cadena
+          if (!WriteOperation(output, str, opcode, options.compact,
+                              options.min_length, options.max_length)) {
+            // Código de operación inválido
+            Usage(argv[0]);
+            return 1;
+          }
+          break;
       }
     }
 
@@ -0,0 +1,406 @@
+/**
+ * @file Operations.cc
+ * @brief Implementación de las operaciones que se aplican a una única cadena
+ * @author Hector Luis Mariño Fernandez
+ * @date 19 de octubre de 2026
+ */
+
+// Universidad de La Laguna
+// Escuela Superior de Ingeniería y Tecnología
+// Grado en Ingeniería Informática
+// Asignatura: Computabilidad y Algoritmia
+// Curso: 2º
+// Práctica 2: Cadenas y lenguajes
+// Autor: Hector Luis Mariño Fernandez
+// Correo: alu0100595604@ull.edu.es
+// Fecha: 19/10/2026
+// Archivo Operations.cc: implementación de las operaciones por cadena.
+// Contiene la selección de la operación según el opcode y la escritura
+// de su resultado
+// Referencias:
+// https://google.github.io/styleguide/cppguide.html
+//
+// Historial de revisiones
+// 19/10/2026 - Creación (primera versión) del código
+
+#include "Operations.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+/// Palabras que genera cada hilo antes de volcar su bloque a la salida
+constexpr uint64_t kWordsPerBlock = uint64_t{1} << 16;
+
+/**
+ * @brief Genera un tramo de palabras de longitud fija en un búfer
+ * @param alphabet Alfabeto de las palabras
+ * @param length Longitud de las palabras
+ * @param first Posición de la primera palabra del tramo
+ * @param count Número de palabras del tramo
+ * @param buffer Búfer donde se añaden las palabras, cada una precedida de
+ * ", "
+ */
+void GenerateWordBlock(const Alphabet& alphabet, size_t length,
+                       uint64_t first, uint64_t count, std::string& buffer) {
+  std::string word;
+  alphabet.Unrank(first, length, word);
+  buffer.reserve(count * (length + 2));
+  for (uint64_t i = 0; i < count; ++i) {
+    buffer += ", ";
+    buffer += word;
+    alphabet.NextWord(word);
+  }
+}
+
+/// Tabla de pertenencia de cada byte a un alfabeto
+using SymbolTable = std::array<bool, 256>;
+
+/**
+ * @brief Escribe una línea de uso de símbolos a partir de su histograma
+ * @param os Flujo de salida
+ * @param counts Apariciones de cada byte
+ * @param declared Bytes declarados en el alfabeto
+ */
+void WriteUsageLine(std::ostream& os, const std::array<size_t, 256>& counts,
+                    const SymbolTable& declared) {
+  std::string used_symbols, unused, undeclared;
+  size_t declared_count = 0;
+  for (size_t c = 0; c < counts.size(); ++c) {
+    declared_count += declared[c];
+    if (counts[c] > 0) {
+      used_symbols += static_cast<char>(c);
+      if (!declared[c]) undeclared += static_cast<char>(c);
+    } else if (declared[c]) {
+      unused += static_cast<char>(c);
+    }
+  }
+  size_t used_declared = declared_count - unused.length();
+
+  auto write_set = [&os](const std::string& symbols) {
+    os << " {";
+    for (size_t i = 0; i < symbols.length(); ++i) {
+      os << (i > 0 ? ", " : "") << symbols[i];
+    }
+    os << "}";
+  };
+
+  os << used_declared << "/" << declared_count << " {";
+  for (size_t i = 0; i < used_symbols.length(); ++i) {
+    os << (i > 0 ? ", " : "") << used_symbols[i] << ":"
+       << counts[static_cast<unsigned char>(used_symbols[i])];
+  }
+  os << "}";
+  write_set(unused);
+  write_set(undeclared);
+  os << "\n";
+}
+
+}  // namespace
+
+/**
+ * @brief Obtiene cuántos hilos pueden trabajar a la vez en esta máquina
+ * hardware_concurrency puede devolver 0 si no lo sabe; en ese caso se
+ * trabaja con un solo hilo
+ * @return size_t Número de hilos hardware, al menos 1
+ */
+size_t HardwareThreads() {
+  return std::max(1u, std::thread::hardware_concurrency());
+}
+
+/**
+ * @brief Escribe un lenguaje en una línea de la salida
+ * @param os Flujo de salida
+ * @param lang Lenguaje a escribir
+ * @param compact true para usar el formato compacto por prefijos compartidos
+ */
+void WriteLanguage(std::ostream& os, const Language& lang, bool compact) {
+  if (compact) {
+    lang.WriteFrontCoded(os);
+    os << "\n";
+  } else {
+    os << lang << std::endl;
+  }
+}
+
+/**
+ * @brief Escribe en una línea el resultado de una operación sobre una cadena
+ * @param os Flujo de salida
+ * @param str Cadena sobre la que se aplica la operación
+ * @param opcode Código de operación
+ * @param compact true para escribir los lenguajes en formato compacto
+ * @param min_length Longitud mínima de las palabras de los opcodes 4 a 6
+ * @param max_length Longitud máxima de las palabras de los opcodes 4 a 6
+ * @return true si el opcode es una operación por cadena, false si no lo es
+ */
+bool WriteOperation(std::ostream& os, const String& str, int opcode,
+                    bool compact, size_t min_length, size_t max_length) {
+  switch (opcode) {
+    case 1:
+      // Mostrar alfabeto de la cadena
+      os << str.GetAlphabet() << std::endl;
+      return true;
+    case 2:
+      // Mostrar longitud de la cadena
+      os << str.Length() << std::endl;
+      return true;
+    case 3:
+      // Mostrar cadena inversa
+      os << str.Reverse() << std::endl;
+      return true;
+    case 4:
+      // Mostrar prefijos de la cadena
+      WriteLanguage(os, str.Prefixes(min_length, max_length), compact);
+      return true;
+    case 5:
+      // Mostrar sufijos de la cadena
+      WriteLanguage(os, str.Suffixes(min_length, max_length), compact);
+      return true;
+
+    case 6:
+      // Mostrar subsecuencias que no son subcadenas
+      WriteLanguage(os, str.Subsequences(min_length, max_length), compact);
+      return true;
+
+    case 7:
+      // Mostrar la subcadena palíndroma más larga
+      os << str.LongestPalindrome() << std::endl;
+      return true;
+    case 8:
+      // Mostrar la subcadena repetida más larga
+      os << str.LongestRepeatedSubstring() << std::endl;
+      return true;
+    case 9:
+      // Mostrar el periodo mínimo de la cadena
+      os << str.SmallestPeriod() << std::endl;
+      return true;
+    case 10: {
+      // Mostrar el array de bordes separado por espacios
+      std::vector<size_t> borders = str.BorderArray();
+      for (size_t j = 0; j < borders.size(); ++j) {
+        os << (j > 0 ? " " : "") << borders[j];
+      }
+      os << std::endl;
+      return true;
+    }
+    default:
+      return false;
+  }
+}
+
+/**
+ * @brief Escribe en una línea todas las palabras de Σ^k para un rango de k
+ * Para cada longitud el espacio de palabras se divide en bloques que se
+ * generan en paralelo: cada hilo sitúa su primera palabra con Unrank y
+ * avanza con NextWord. Los bloques se escriben en orden, así que la salida
+ * no depende del número de hilos
+ * @param os Flujo de salida
+ * @param alphabet Alfabeto Σ
+ * @param min_length Longitud mínima de las palabras
+ * @param max_length Longitud máxima de las palabras
+ * @throws std::overflow_error si alguna longitud tiene más de 2^64 palabras
+ */
+void WriteWords(std::ostream& os, const Alphabet& alphabet, size_t min_length,
+                size_t max_length) {
+  // |Σ|^k crece con k: si la longitud máxima cabe, caben todas, y si no, se
+  // falla antes de escribir media línea
+  alphabet.WordCount(max_length);
+
+  size_t thread_count = HardwareThreads();
+  std::vector<std::string> buffers(thread_count);
+  bool first = true;
+
+  os << "{";
+  for (size_t length = min_length; length <= max_length; ++length) {
+    uint64_t total = alphabet.WordCount(length);
+    if (length == 0 && total == 1) {
+      os << "&";  // La palabra vacía se escribe como &
+      first = false;
+      continue;
+    }
+
+    for (uint64_t start = 0; start < total;) {
+      std::vector<std::thread> workers;
+      size_t used = 0;
+      for (; used < thread_count && start < total; ++used) {
+        uint64_t count = std::min(kWordsPerBlock, total - start);
+        buffers[used].clear();
+        if (total <= kWordsPerBlock) {
+          // Un único bloque: no compensa lanzar un hilo
+          GenerateWordBlock(alphabet, length, start, count, buffers[used]);
+        } else {
+          workers.emplace_back(GenerateWordBlock, std::cref(alphabet), length,
+                               start, count, std::ref(buffers[used]));
+        }
+        start += count;
+      }
+      for (auto& worker : workers) {
+        worker.join();
+      }
+      for (size_t i = 0; i < used; ++i) {
+        // El primer bloque de la línea no lleva el separador inicial
+        size_t skip = first ? 2 : 0;
+        os.write(buffers[i].data() + skip, buffers[i].size() - skip);
+        first = false;
+      }
+    }
+  }
+  os << "}" << std::endl;
+}
+
+/**
+ * @brief Escribe una medida entre cadenas del lote, repartida entre hilos
+ * Los hilos toman filas de un contador atómico; en la comparación todas
+ * contra todas solo se calcula el triángulo superior, ya que la medida es
+ * simétrica, y la diagonal no se calcula porque su valor se conoce de
+ * antemano. Las filas largas van primero en el reparto, pero el resultado se
+ * escribe siempre en el orden de las cadenas
+ * @param os Flujo de salida
+ * @param strings Cadenas del lote
+ * @param measure Medida simétrica a calcular
+ * @param similarity true si la medida es de parecido (una cadena consigo
+ * misma vale su longitud), false si es de distancia (vale 0)
+ * @param reference Posición (desde 0) de la cadena de referencia, o
+ * strings.size() para comparar todas contra todas
+ */
+void WriteComparison(std::ostream& os, const std::vector<String>& strings,
+                     StringMeasure measure, bool similarity,
+                     size_t reference) {
+  size_t n = strings.size();
+  bool all_pairs = reference >= n;
+  std::vector<size_t> values(all_pairs ? n * n : n, 0);
+
+  auto self_measure = [&](size_t i) -> size_t {
+    return similarity ? strings[i].Length() : 0;
+  };
+
+  std::atomic<size_t> next_row{0};
+  auto work = [&]() {
+    for (size_t i = next_row++; i < n; i = next_row++) {
+      if (all_pairs) {
+        for (size_t j = i + 1; j < n; ++j) {
+          size_t value = (strings[i].*measure)(strings[j]);
+          values[i * n + j] = value;
+          values[j * n + i] = value;
+        }
+        values[i * n + i] = self_measure(i);
+      } else if (i == reference) {
+        values[i] = self_measure(i);
+      } else {
+        values[i] = (strings[i].*measure)(strings[reference]);
+      }
+    }
+  };
+
+  size_t thread_count = std::min(HardwareThreads(), n);
+  std::vector<std::thread> workers;
+  for (size_t t = 1; t < thread_count; ++t) {
+    workers.emplace_back(work);
+  }
+  work();
+  for (auto& worker : workers) {
+    worker.join();
+  }
+
+  size_t columns = all_pairs ? n : 1;
+  for (size_t i = 0; i < n; ++i) {
+    for (size_t j = 0; j < columns; ++j) {
+      os << (j > 0 ? " " : "") << values[i * columns + j];
+    }
+    os << "\n";
+  }
+}
+
+/**
+ * @brief Escribe, para cada consulta, las líneas del lote que la contienen
+ * @param os Flujo de salida
+ * @param automaton Autómata de sufijos del lote
+ * @param queries Subcadenas a consultar
+ */
+void WriteSubstringQueries(std::ostream& os, const SuffixAutomaton& automaton,
+                           const std::vector<std::string>& queries) {
+  for (const std::string& query : queries) {
+    os << automaton.LineCount(query);
+    for (size_t line : automaton.Lines(query)) {
+      os << " " << line + 1;
+    }
+    os << "\n";
+  }
+}
+
+/**
+ * @brief Escribe la subcadena común más larga entre líneas del lote
+ * @param os Flujo de salida
+ * @param automaton Autómata de sufijos del lote
+ * @param line_count Número de líneas del lote
+ * @param reference Posición (desde 0) de la línea de referencia, o
+ * line_count para comparar todos los pares
+ */
+void WriteCommonSubstrings(std::ostream& os, const SuffixAutomaton& automaton,
+                           size_t line_count, size_t reference) {
+  auto write = [&os](const std::string& substring) {
+    if (substring.empty()) {
+      os << "&";  // La palabra vacía se escribe como &
+    } else {
+      os << substring;
+    }
+    os << "\n";
+  };
+
+  if (reference < line_count) {
+    for (size_t i = 0; i < line_count; ++i) {
+      write(automaton.LongestCommonSubstring(reference, i));
+    }
+    return;
+  }
+  for (size_t i = 0; i < line_count; ++i) {
+    for (size_t j = i + 1; j < line_count; ++j) {
+      os << i + 1 << " " << j + 1 << " ";
+      write(automaton.LongestCommonSubstring(i, j));
+    }
+  }
+}
+
+/**
+ * @brief Escribe el uso de los símbolos de cada cadena frente a su alfabeto
+ * El histograma de cada cadena se obtiene de String::SymbolCounts sin copiar
+ * su contenido, y los alfabetos se convierten una sola vez en tablas de
+ * pertenencia (las cadenas comparten la copia de Alphabet::Intern), así que
+ * ningún símbolo se busca en el conjunto del alfabeto
+ * @param os Flujo de salida
+ * @param strings Cadenas del lote
+ */
+void WriteSymbolUsage(std::ostream& os, const std::vector<String>& strings) {
+  std::map<const Alphabet*, SymbolTable> tables;
+  std::array<size_t, 256> total_counts{};
+  SymbolTable total_declared{};
+
+  for (const String& str : strings) {
+    const Alphabet& alphabet = str.GetAlphabet();
+    auto [it, inserted] = tables.try_emplace(&alphabet);
+    if (inserted) {
+      for (char c : alphabet.GetSymbols()) {
+        it->second[static_cast<unsigned char>(c)] = true;
+      }
+    }
+    const SymbolTable& declared = it->second;
+
+    std::array<size_t, 256> counts = str.SymbolCounts();
+    for (size_t c = 0; c < counts.size(); ++c) {
+      total_counts[c] += counts[c];
+      total_declared[c] = total_declared[c] || declared[c];
+    }
+    WriteUsageLine(os, counts, declared);
+  }
+
+  os << "Total ";
+  WriteUsageLine(os, total_counts, total_declared);
+}
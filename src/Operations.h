@@ -0,0 +1,138 @@
+/**
+ * @file Operations.h
+ * @brief Operaciones del programa que se aplican a una única cadena
+ * @author Hector Luis Mariño Fernandez
+ * @date 19 de octubre de 2026
+ */
+
+// Universidad de La Laguna
+// Escuela Superior de Ingeniería y Tecnología
+// Grado en Ingeniería Informática
+// Asignatura: Computabilidad y Algoritmia
+// Curso: 2º
+// Práctica 2: Cadenas y lenguajes
+// Autor: Hector Luis Mariño Fernandez
+// Correo: alu0100595604@ull.edu.es
+// Fecha: 19/10/2026
+// Archivo Operations.h: declaración de las operaciones por cadena.
+// Contiene las funciones que traducen un código de operación en su
+// resultado escrito, compartidas por el modo por lotes y el servidor
+// Referencias:
+// https://google.github.io/styleguide/cppguide.html
+//
+// Historial de revisiones
+// 19/10/2026 - Creación (primera versión) del código
+
+#ifndef OPERATIONS_H
+#define OPERATIONS_H
+
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "Alphabet.h"
+#include "Language.h"
+#include "String.h"
+#include "SuffixAutomaton.h"
+
+/**
+ * @brief Obtiene cuántos hilos pueden trabajar a la vez en esta máquina
+ * @return size_t Número de hilos hardware, al menos 1 aunque no se conozca
+ */
+size_t HardwareThreads();
+
+/**
+ * @brief Escribe un lenguaje en una línea de la salida
+ * @param os Flujo de salida
+ * @param lang Lenguaje a escribir
+ * @param compact true para usar el formato compacto por prefijos compartidos
+ */
+void WriteLanguage(std::ostream& os, const Language& lang, bool compact);
+
+/**
+ * @brief Escribe en una línea el resultado de una operación sobre una cadena
+ * Solo cubre los opcodes que dependen únicamente de la cadena (1 a 10)
+ * @param os Flujo de salida
+ * @param str Cadena sobre la que se aplica la operación
+ * @param opcode Código de operación
+ * @param compact true para escribir los lenguajes en formato compacto
+ * @param min_length Longitud mínima de las palabras de los opcodes 4 a 6
+ * @param max_length Longitud máxima de las palabras de los opcodes 4 a 6
+ * @return true si el opcode es una operación por cadena, false si no lo es
+ */
+bool WriteOperation(std::ostream& os, const String& str, int opcode,
+                    bool compact, size_t min_length = 0,
+                    size_t max_length = String::kNoMaxLength);
+
+/**
+ * @brief Escribe en una línea todas las palabras de Σ^k para un rango de k
+ * Las palabras se escriben en orden por longitud y lexicográfico, con el
+ * mismo formato que un lenguaje, sin construirlo en memoria
+ * @param os Flujo de salida
+ * @param alphabet Alfabeto Σ
+ * @param min_length Longitud mínima de las palabras
+ * @param max_length Longitud máxima de las palabras
+ * @throws std::overflow_error si alguna longitud tiene más de 2^64 palabras
+ */
+void WriteWords(std::ostream& os, const Alphabet& alphabet, size_t min_length,
+                size_t max_length);
+
+/**
+ * @brief Medida entre dos cadenas, como String::EditDistance
+ */
+using StringMeasure = size_t (String::*)(const String&) const;
+
+/**
+ * @brief Escribe una medida entre cadenas del lote, repartida entre hilos
+ * Sin cadena de referencia escribe la matriz completa (una fila por cadena,
+ * valores separados por espacios); con referencia, una línea por cadena con
+ * su medida respecto a la de referencia
+ * @param os Flujo de salida
+ * @param strings Cadenas del lote
+ * @param measure Medida simétrica a calcular
+ * @param similarity true si la medida es de parecido (una cadena consigo
+ * misma vale su longitud), false si es de distancia (vale 0)
+ * @param reference Posición (desde 0) de la cadena de referencia, o
+ * strings.size() para comparar todas contra todas
+ */
+void WriteComparison(std::ostream& os, const std::vector<String>& strings,
+                     StringMeasure measure, bool similarity, size_t reference);
+
+/**
+ * @brief Escribe, para cada consulta, las líneas del lote que la contienen
+ * Cada consulta produce una línea con el número de líneas que la contienen
+ * como subcadena seguido de esas líneas (numeradas desde 1)
+ * @param os Flujo de salida
+ * @param automaton Autómata de sufijos del lote
+ * @param queries Subcadenas a consultar
+ */
+void WriteSubstringQueries(std::ostream& os, const SuffixAutomaton& automaton,
+                           const std::vector<std::string>& queries);
+
+/**
+ * @brief Escribe la subcadena común más larga entre líneas del lote
+ * Sin referencia se escribe una línea `i j subcadena` por cada par i < j
+ * (numerados desde 1); con referencia, la subcadena de cada línea con ella
+ * @param os Flujo de salida
+ * @param automaton Autómata de sufijos del lote
+ * @param line_count Número de líneas del lote
+ * @param reference Posición (desde 0) de la línea de referencia, o
+ * line_count para comparar todos los pares
+ */
+void WriteCommonSubstrings(std::ostream& os, const SuffixAutomaton& automaton,
+                           size_t line_count, size_t reference);
+
+/**
+ * @brief Escribe el uso de los símbolos de cada cadena frente a su alfabeto
+ * Cada cadena produce una línea `usados/declarados {s:n, ...} {sin usar}
+ * {ajenos}`: símbolos declarados que se usan frente a todos los declarados,
+ * apariciones de cada símbolo, símbolos declarados sin usar y símbolos
+ * usados sin declarar. Una última línea `Total ...` acumula todo el lote
+ * frente a la unión de los alfabetos
+ * @param os Flujo de salida
+ * @param strings Cadenas del lote
+ */
+void WriteSymbolUsage(std::ostream& os, const std::vector<String>& strings);
+
+#endif
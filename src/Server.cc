@@ -0,0 +1,310 @@
+/**
+ * @file Server.cc
+ * @brief Implementación de la clase Server
+ * @author Hector Luis Mariño Fernandez
+ * @date 19 de octubre de 2026
+ */
+
+// Universidad de La Laguna
+// Escuela Superior de Ingeniería y Tecnología
+// Grado en Ingeniería Informática
+// Asignatura: Computabilidad y Algoritmia
+// Curso: 2º
+// Práctica 2: Cadenas y lenguajes
+// Autor: Hector Luis Mariño Fernandez
+// Correo: alu0100595604@ull.edu.es
+// Fecha: 19/10/2026
+// Archivo Server.cc: implementación de la clase Server.
+// Contiene el bucle de aceptación de conexiones, el protocolo por líneas
+// y las cachés de alfabetos y resultados
+// Referencias:
+// https://man7.org/linux/man-pages/man7/unix.7.html
+//
+// Historial de revisiones
+// 19/10/2026 - Creación (primera versión) del código
+
+#include "Server.h"
+
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#include <iostream>
+#include <mutex>
+#include <set>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+
+#include "Operations.h"
+#include "String.h"
+
+namespace {
+
+/**
+ * @brief Envía un bloque completo por un socket
+ * @param fd Descriptor del socket
+ * @param data Datos a enviar
+ * @return true si se envió todo, false si el cliente cerró la conexión
+ */
+bool SendAll(int fd, const std::string& data) {
+  size_t sent = 0;
+  while (sent < data.size()) {
+    ssize_t n = send(fd, data.data() + sent, data.size() - sent, MSG_NOSIGNAL);
+    if (n < 0 && errno == EINTR) continue;
+    if (n <= 0) return false;
+    sent += static_cast<size_t>(n);
+  }
+  return true;
+}
+
+}  // namespace
+
+/**
+ * @brief Crea un servidor asociado a la ruta de un socket
+ * @param socket_path Ruta del socket de dominio Unix
+ */
+Server::Server(const std::string& socket_path)
+    : socket_path_(socket_path), start_(std::chrono::steady_clock::now()) {}
+
+/**
+ * @brief Cierra las conexiones abiertas y espera a que terminen sus hilos
+ * Los hilos de las conexiones usan el servidor, así que no puede destruirse
+ * mientras quede alguno. shutdown despierta a los que esperan en recv
+ */
+Server::~Server() {
+  std::unique_lock<std::mutex> lock(clients_mutex_);
+  for (int client : clients_) {
+    shutdown(client, SHUT_RDWR);
+  }
+  clients_closed_.wait(lock, [this] { return clients_.empty(); });
+}
+
+/**
+ * @brief Escucha en el socket y atiende conexiones indefinidamente
+ * Si la ruta ya existe y es un socket (por ejemplo, de una ejecución
+ * anterior) se elimina antes de crear el nuevo; cualquier otro fichero se
+ * deja intacto
+ * @throws std::runtime_error si no se puede crear o escuchar el socket, o si
+ * la ruta ya existe y no es un socket
+ */
+void Server::Run() {
+  sockaddr_un address{};
+  address.sun_family = AF_UNIX;
+  if (socket_path_.size() >= sizeof(address.sun_path)) {
+    throw std::runtime_error("Ruta de socket demasiado larga: " +
+                             socket_path_);
+  }
+  std::strcpy(address.sun_path, socket_path_.c_str());
+
+  int listener = socket(AF_UNIX, SOCK_STREAM, 0);
+  if (listener < 0) {
+    throw std::runtime_error("No se pudo crear el socket: " +
+                             std::string(std::strerror(errno)));
+  }
+  struct stat info;
+  if (lstat(socket_path_.c_str(), &info) == 0) {
+    if (!S_ISSOCK(info.st_mode)) {
+      close(listener);
+      throw std::runtime_error("La ruta ya existe y no es un socket: " +
+                               socket_path_);
+    }
+    unlink(socket_path_.c_str());
+  }
+  if (bind(listener, reinterpret_cast<sockaddr*>(&address),
+           sizeof(address)) < 0 ||
+      listen(listener, SOMAXCONN) < 0) {
+    std::string reason = std::strerror(errno);
+    close(listener);
+    throw std::runtime_error("No se pudo escuchar en " + socket_path_ + ": " +
+                             reason);
+  }
+
+  std::cout << "Servidor escuchando en: " << socket_path_ << std::endl;
+  while (true) {
+    int client = accept(listener, nullptr, nullptr);
+    if (client < 0) {
+      if (errno == EINTR || errno == ECONNABORTED) continue;
+      std::string reason = std::strerror(errno);
+      close(listener);
+      throw std::runtime_error("Error al aceptar conexiones: " + reason);
+    }
+    {
+      std::lock_guard<std::mutex> lock(clients_mutex_);
+      clients_.insert(client);
+    }
+    std::thread(&Server::HandleConnection, this, client).detach();
+  }
+}
+
+/**
+ * @brief Responde a una petición
+ * Comprueba primero la caché de resultados; si no hay acierto calcula la
+ * respuesta y la guarda mientras no se supere kMaxCachedBytes
+ * @param request Línea de la petición, sin el salto de línea
+ * @return std::string Respuesta terminada en salto de línea
+ */
+std::string Server::HandleRequest(const std::string& request) {
+  auto begin = std::chrono::steady_clock::now();
+  std::istringstream iss(request);
+  std::string content, alphabet_str, opcode_str, flag, extra;
+  iss >> content >> alphabet_str >> opcode_str >> flag >> extra;
+
+  std::string response;
+  if (content == "ESTADISTICAS" && alphabet_str.empty()) {
+    return Statistics();
+  }
+
+  int opcode = 0;
+  try {
+    opcode = std::stoi(opcode_str);
+  } catch (const std::exception&) {
+    opcode = 0;
+  }
+  bool compact = flag == "--compacto";
+  if (opcode_str.empty() || (!flag.empty() && !compact) || !extra.empty()) {
+    response = "ERROR formato: <cadena> <alfabeto> <opcode> [--compacto]\n";
+  } else {
+    // Clave de caché con el alfabeto normalizado (ordenado y sin repetir)
+    std::set<char> unique(alphabet_str.begin(), alphabet_str.end());
+    std::string symbols(unique.begin(), unique.end());
+    std::string key = content + ' ' + symbols + ' ' + std::to_string(opcode) +
+                      (compact ? " c" : "");
+
+    bool hit = false;
+    {
+      std::shared_lock<std::shared_mutex> lock(results_mutex_);
+      auto it = results_.find(key);
+      if (it != results_.end()) {
+        response = it->second;
+        hit = true;
+      }
+    }
+
+    if (hit) {
+      ++cache_hits_;
+    } else {
+      // Un fallo al calcular (por ejemplo, falta de memoria) solo afecta a
+      // esta petición, no al servidor ni a las demás conexiones
+      try {
+        response = Compute(content, symbols, opcode, compact);
+      } catch (const std::exception& e) {
+        response = std::string("ERROR ") + e.what() + "\n";
+      }
+      if (response.rfind("ERROR", 0) != 0) {
+        std::unique_lock<std::shared_mutex> lock(results_mutex_);
+        size_t bytes = key.size() + response.size();
+        if (cached_bytes_ + bytes <= kMaxCachedBytes &&
+            results_.emplace(key, response).second) {
+          cached_bytes_ += bytes;
+        }
+      }
+    }
+  }
+
+  if (response.rfind("ERROR", 0) == 0) {
+    ++errors_;
+  }
+  uint64_t latency = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                         std::chrono::steady_clock::now() - begin)
+                         .count();
+  ++requests_;
+  total_latency_ns_ += latency;
+  uint64_t previous = max_latency_ns_.load();
+  while (latency > previous &&
+         !max_latency_ns_.compare_exchange_weak(previous, latency)) {
+  }
+  return response;
+}
+
+/**
+ * @brief Atiende una conexión hasta que el cliente la cierra
+ * Las peticiones de una misma conexión se responden en orden. Si se reciben
+ * más de kMaxRequestBytes sin salto de línea se cierra la conexión. Al
+ * terminar, el hilo se da de baja en clients_; es lo último que hace con el
+ * servidor
+ * @param client Descriptor del socket del cliente
+ */
+void Server::HandleConnection(int client) {
+  ++connections_;
+  std::string pending;
+  char buffer[4096];
+  bool open = true;
+  while (open) {
+    ssize_t n = recv(client, buffer, sizeof(buffer), 0);
+    if (n < 0 && errno == EINTR) continue;
+    if (n <= 0) break;
+    pending.append(buffer, static_cast<size_t>(n));
+
+    size_t start = 0;
+    size_t end;
+    while (open && (end = pending.find('\n', start)) != std::string::npos) {
+      std::string line = pending.substr(start, end - start);
+      if (!line.empty() && line.back() == '\r') line.pop_back();
+      start = end + 1;
+      if (line.empty()) continue;
+      open = SendAll(client, HandleRequest(line));
+    }
+    pending.erase(0, start);
+    if (open && pending.size() > kMaxRequestBytes) {
+      ++errors_;
+      SendAll(client, "ERROR petición demasiado larga\n");
+      open = false;
+    }
+  }
+  --connections_;
+  std::lock_guard<std::mutex> lock(clients_mutex_);
+  close(client);
+  clients_.erase(client);
+  clients_closed_.notify_all();
+}
+
+/**
+ * @brief Calcula la respuesta de una petición sin usar la caché
+ * @param content Contenido de la cadena
+ * @param symbols Símbolos del alfabeto, ordenados y sin repetir
+ * @param opcode Código de operación
+ * @param compact true para escribir los lenguajes en formato compacto
+ * @return std::string Respuesta terminada en salto de línea
+ */
+std::string Server::Compute(const std::string& content,
+                            const std::string& symbols, int opcode,
+                            bool compact) {
+  // El constructor comparte el alfabeto mediante Alphabet::Intern
+  Alphabet alphabet(std::set<char>(symbols.begin(), symbols.end()));
+  String str(content, alphabet);
+  std::ostringstream oss;
+  if (!WriteOperation(oss, str, opcode, compact)) {
+    return "ERROR opcode no disponible en el servidor: " +
+           std::to_string(opcode) + "\n";
+  }
+  return oss.str();
+}
+
+/**
+ * @brief Genera la línea con los contadores del servidor
+ * La latencia se mide desde que se recibe la petición hasta que se tiene la
+ * respuesta; el rendimiento es el número de peticiones por segundo desde
+ * que arrancó el servidor
+ * @return std::string Contadores en formato clave=valor
+ */
+std::string Server::Statistics() const {
+  uint64_t requests = requests_.load();
+  double seconds = std::chrono::duration<double>(
+                       std::chrono::steady_clock::now() - start_)
+                       .count();
+  double mean_us =
+      requests == 0 ? 0.0 : total_latency_ns_.load() / 1000.0 / requests;
+
+  std::ostringstream oss;
+  oss << "peticiones=" << requests << " aciertos_cache=" << cache_hits_.load()
+      << " errores=" << errors_.load() << " conexiones=" << connections_.load()
+      << " latencia_media_us=" << mean_us
+      << " latencia_max_us=" << max_latency_ns_.load() / 1000.0
+      << " peticiones_por_segundo=" << (seconds > 0 ? requests / seconds : 0.0)
+      << "\n";
+  return oss.str();
+}
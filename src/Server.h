@@ -0,0 +1,131 @@
+/**
+ * @file Server.h
+ * @brief Definición de la clase Server para atender peticiones por un socket
+ * @author Hector Luis Mariño Fernandez
+ * @date 19 de octubre de 2026
+ */
+
+// Universidad de La Laguna
+// Escuela Superior de Ingeniería y Tecnología
+// Grado en Ingeniería Informática
+// Asignatura: Computabilidad y Algoritmia
+// Curso: 2º
+// Práctica 2: Cadenas y lenguajes
+// Autor: Hector Luis Mariño Fernandez
+// Correo: alu0100595604@ull.edu.es
+// Fecha: 19/10/2026
+// Archivo Server.h: definición de la clase Server.
+// Contiene el servidor residente que atiende peticiones sobre un socket
+// de dominio Unix manteniendo en memoria alfabetos y resultados
+// Referencias:
+// https://man7.org/linux/man-pages/man7/unix.7.html
+//
+// Historial de revisiones
+// 19/10/2026 - Creación (primera versión) del código
+
+#ifndef SERVER_H
+#define SERVER_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <set>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+
+/**
+ * @brief Servidor residente sobre un socket de dominio Unix
+ *
+ * Cada línea recibida es una petición con la misma forma que una línea del
+ * archivo de entrada seguida del opcode: "<cadena> <alfabeto> <opcode>",
+ * con "--compacto" opcional al final. La respuesta es la línea que el modo
+ * por lotes escribiría en el archivo de salida, o "ERROR <motivo>". La
+ * petición "ESTADISTICAS" devuelve los contadores de latencia y
+ * rendimiento. Cada conexión se atiende en su propio hilo; los resultados ya
+ * calculados se comparten entre todas las conexiones, y los alfabetos, como
+ * en el resto del programa, con Alphabet::Intern.
+ */
+class Server {
+ public:
+  /// Bytes máximos de resultados guardados en la caché
+  static constexpr size_t kMaxCachedBytes = size_t{64} << 20;
+
+  /// Bytes máximos de una petición; una línea más larga cierra la conexión
+  static constexpr size_t kMaxRequestBytes = size_t{1} << 20;
+
+  // ==================== CONSTRUCTORES ====================
+
+  /**
+   * @brief Crea un servidor asociado a la ruta de un socket
+   * @param socket_path Ruta del socket de dominio Unix
+   */
+  explicit Server(const std::string& socket_path);
+
+  /**
+   * @brief Cierra las conexiones abiertas y espera a que terminen sus hilos
+   */
+  ~Server();
+
+  // ==================== MÉTODOS DE EJECUCIÓN ====================
+
+  /**
+   * @brief Escucha en el socket y atiende conexiones indefinidamente
+   * @throws std::runtime_error si no se puede crear o escuchar el socket
+   */
+  void Run();
+
+  /**
+   * @brief Responde a una petición
+   * @param request Línea de la petición, sin el salto de línea
+   * @return std::string Respuesta terminada en salto de línea
+   */
+  std::string HandleRequest(const std::string& request);
+
+ private:
+  std::string socket_path_;  ///< Ruta del socket de dominio Unix
+
+  std::shared_mutex results_mutex_;  ///< Protege results_ y cached_bytes_
+  std::unordered_map<std::string, std::string> results_;  ///< Respuestas
+  size_t cached_bytes_ = 0;  ///< Bytes ocupados por las respuestas guardadas
+
+  std::chrono::steady_clock::time_point start_;  ///< Inicio del servidor
+  std::atomic<uint64_t> requests_{0};            ///< Peticiones atendidas
+  std::atomic<uint64_t> cache_hits_{0};          ///< Respuestas desde caché
+  std::atomic<uint64_t> errors_{0};              ///< Peticiones erróneas
+  std::atomic<uint64_t> total_latency_ns_{0};    ///< Suma de latencias
+  std::atomic<uint64_t> max_latency_ns_{0};      ///< Latencia máxima
+  std::atomic<int> connections_{0};              ///< Conexiones abiertas
+
+  std::mutex clients_mutex_;  ///< Protege clients_
+  std::condition_variable clients_closed_;  ///< Avisa al cerrarse un cliente
+  std::set<int> clients_;  ///< Sockets de las conexiones en curso
+
+  /**
+   * @brief Atiende una conexión hasta que el cliente la cierra
+   * @param client Descriptor del socket del cliente
+   */
+  void HandleConnection(int client);
+
+  /**
+   * @brief Calcula la respuesta de una petición sin usar la caché
+   * @param content Contenido de la cadena
+   * @param symbols Símbolos del alfabeto, ordenados y sin repetir
+   * @param opcode Código de operación
+   * @param compact true para escribir los lenguajes en formato compacto
+   * @return std::string Respuesta terminada en salto de línea
+   */
+  std::string Compute(const std::string& content, const std::string& symbols,
+                      int opcode, bool compact);
+
+  /**
+   * @brief Genera la línea con los contadores del servidor
+   * @return std::string Contadores en formato clave=valor
+   */
+  std::string Statistics() const;
+};
+
+#endif
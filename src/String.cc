@@ -5,12 +5,108 @@
  * @date 21 de septiembre de 2025
  */
 
+// Universidad de La Laguna
+// Escuela Superior de Ingeniería y Tecnología
+// Grado en Ingeniería Informática
+// Asignatura: Computabilidad y Algoritmia
+// Curso: 2º
+// Práctica 2: Cadenas y lenguajes
+// Autor: Hector Luis Mariño Fernandez
+// Correo: alu0100595604@ull.edu.es
+// Fecha: 21/09/2025
+// Archivo String.cc: implementación de la clase String.
+// Contiene los métodos de String: prefijos, sufijos, subsecuencias,
+// análisis de la cadena y medidas entre cadenas
+// Referencias:
+// https://en.wikipedia.org/wiki/String_(computer_science)
+//
+// Historial de revisiones
+// 21/09/2025 - Creación (primera versión) del código
+// 19/10/2026 - Operaciones de palíndromos, repeticiones, periodos y bordes
+// 19/10/2026 - Consultas de subsecuencias con SubsequenceIndex
+// 19/10/2026 - Hash de la cadena en caché para Language con tabla hash
+// 19/10/2026 - Representación compacta para cadenas cortas
+// 19/10/2026 - Prefijos, sufijos y subsecuencias con rango de longitudes
+// 19/10/2026 - Distancia de edición y LCS con paralelismo de bits
+// 19/10/2026 - Recuento de símbolos para el opcode 20
+
 #include "String.h"
 
 #include <algorithm>
+#include <array>
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
 
 #include "Language.h"
+#include "SubsequenceIndex.h"
+
+namespace {
+
+/// Bits por palabra de máquina en los algoritmos de paralelismo de bits
+constexpr size_t kWordBits = 64;
+
+/**
+ * @brief Máscaras de aparición de cada símbolo de un patrón
+ * Para cada símbolo c, el bit i de su máscara vale 1 si pattern[i] == c. El
+ * patrón se divide en bloques de kWordBits símbolos; solo se guardan filas
+ * para los símbolos del patrón, el resto comparte una fila de ceros
+ */
+class PatternMasks {
+ public:
+  /**
+   * @brief Construye las máscaras de un patrón
+   * @param pattern Patrón cuyas apariciones se codifican
+   */
+  explicit PatternMasks(std::string_view pattern)
+      : blocks_((pattern.length() + kWordBits - 1) / kWordBits) {
+    row_.fill(0);
+    size_t rows = 1;  // La fila 0 es la de los símbolos ausentes
+    for (char c : pattern) {
+      uint32_t& row = row_[static_cast<unsigned char>(c)];
+      if (row == 0) {
+        row = static_cast<uint32_t>(rows++);
+      }
+    }
+    masks_.assign(rows * blocks_, 0);
+    for (size_t i = 0; i < pattern.length(); ++i) {
+      size_t row = row_[static_cast<unsigned char>(pattern[i])];
+      masks_[row * blocks_ + i / kWordBits] |= uint64_t{1} << (i % kWordBits);
+    }
+  }
+
+  /**
+   * @brief Obtiene las máscaras de un símbolo
+   * @param c Símbolo
+   * @return const uint64_t* Máscara de cada bloque del patrón
+   */
+  const uint64_t* Masks(char c) const {
+    return masks_.data() + row_[static_cast<unsigned char>(c)] * blocks_;
+  }
+
+  /**
+   * @brief Obtiene el número de bloques del patrón
+   * @return size_t Número de palabras de kWordBits bits
+   */
+  size_t Blocks() const { return blocks_; }
+
+ private:
+  size_t blocks_;                     ///< Bloques de kWordBits símbolos
+  std::array<uint32_t, 256> row_;     ///< Byte -> fila de masks_
+  std::vector<uint64_t> masks_;       ///< Máscaras, fila a fila
+};
+
+}  // namespace
+
+static_assert(sizeof(String) == 32,
+              "String debe ocupar lo mismo que un puntero y 24 bytes");
+
+/**
+ * @brief Constructor por defecto que crea una cadena vacía
+ * La cadena queda asociada al alfabeto vacío compartido
+ */
+String::String() : alphabet_(Alphabet::Intern(Alphabet())) {}
 
 /**
  * @brief Constructor que inicializa la cadena con contenido y alfabeto
@@ -19,25 +115,149 @@
  * @param alphabet Alfabeto sobre el cual está definida la cadena
  */
 String::String(const std::string& content, const Alphabet& alphabet)
-    : content_(content), alphabet_(alphabet) {}
+    : String(content, Alphabet::Intern(alphabet)) {}
+
+/**
+ * @brief Constructor interno a partir de un alfabeto ya compartido
+ * Es el que usan las operaciones que generan cadenas a partir de otra, de
+ * modo que no se vuelve a buscar el alfabeto por cada cadena generada
+ * @param content Contenido de la cadena
+ * @param alphabet Alfabeto obtenido de Alphabet::Intern
+ */
+String::String(std::string_view content, const Alphabet* alphabet)
+    : alphabet_(alphabet) {
+  Assign(content);
+}
+
+/**
+ * @brief Constructor de copia
+ * @param other Cadena a copiar
+ */
+String::String(const String& other) : alphabet_(other.alphabet_) {
+  Assign(other.View());
+  hash_ = other.hash_;  // Assign lo reinicia; el contenido es el mismo
+}
+
+/**
+ * @brief Constructor de movimiento
+ * El contenido en memoria dinámica se traspasa sin copiarlo
+ * @param other Cadena cuyo contenido se toma
+ */
+String::String(String&& other) noexcept
+    : alphabet_(other.alphabet_), length_(other.length_), hash_(other.hash_) {
+  std::memcpy(inline_, other.inline_, kInlineCapacity);
+  other.length_ = 0;
+  other.hash_ = 0;
+}
+
+/**
+ * @brief Destructor que libera el contenido en memoria dinámica
+ */
+String::~String() { Release(); }
+
+/**
+ * @brief Asignación por copia
+ * @param other Cadena a copiar
+ * @return String& Referencia a esta cadena
+ */
+String& String::operator=(const String& other) {
+  if (this != &other) {
+    Release();
+    alphabet_ = other.alphabet_;
+    Assign(other.View());
+    hash_ = other.hash_;
+  }
+  return *this;
+}
+
+/**
+ * @brief Asignación por movimiento
+ * @param other Cadena cuyo contenido se toma
+ * @return String& Referencia a esta cadena
+ */
+String& String::operator=(String&& other) noexcept {
+  if (this != &other) {
+    Release();
+    alphabet_ = other.alphabet_;
+    length_ = other.length_;
+    hash_ = other.hash_;
+    std::memcpy(inline_, other.inline_, kInlineCapacity);
+    other.length_ = 0;
+    other.hash_ = 0;
+  }
+  return *this;
+}
+
+/**
+ * @brief Copia un contenido en el almacenamiento de la cadena
+ * Los contenidos de hasta kInlineCapacity símbolos se guardan dentro de la
+ * propia cadena; los más largos, en memoria dinámica
+ * @param content Contenido a copiar; la cadena no debe tener contenido
+ */
+void String::Assign(std::string_view content) {
+  length_ = static_cast<uint32_t>(content.length());
+  hash_ = 0;
+  char* data = inline_;
+  if (length_ > kInlineCapacity) {
+    heap_ = new char[length_];
+    data = heap_;
+  }
+  if (length_ > 0) {
+    std::memcpy(data, content.data(), length_);
+  }
+}
+
+/**
+ * @brief Libera la memoria dinámica del contenido, si la hay
+ */
+void String::Release() {
+  if (length_ > kInlineCapacity) {
+    delete[] heap_;
+  }
+  length_ = 0;
+}
 
 /**
  * @brief Obtiene el contenido de la cadena
  * @return std::string Contenido de la cadena
  */
-std::string String::GetContent() const { return content_; }
+std::string String::GetContent() const { return std::string(View()); }
+
+/**
+ * @brief Obtiene una vista del contenido sin copiarlo
+ * @return std::string_view Contenido, válido mientras viva la cadena
+ */
+std::string_view String::View() const {
+  return std::string_view(length_ > kInlineCapacity ? heap_ : inline_,
+                          length_);
+}
 
 /**
  * @brief Obtiene el alfabeto sobre el cual está definida la cadena
- * @return Alphabet Alfabeto de la cadena
+ * @return const Alphabet& Alfabeto de la cadena
  */
-Alphabet String::GetAlphabet() const { return alphabet_; }
+const Alphabet& String::GetAlphabet() const { return *alphabet_; }
 
 /**
  * @brief Calcula la longitud de la cadena
  * @return size_t Número de símbolos en la cadena
  */
-size_t String::Length() const { return content_.size(); }
+size_t String::Length() const { return length_; }
+
+/**
+ * @brief Obtiene el hash del contenido de la cadena
+ * Se guardan 32 bits del hash, suficientes para las tablas hash de
+ * lenguajes; el valor 0 se reserva para indicar que no está calculado
+ * @return size_t Hash del contenido
+ */
+size_t String::Hash() const {
+  if (hash_ == 0) {
+    uint32_t hash =
+        static_cast<uint32_t>(std::hash<std::string_view>()(View()));
+    hash_ = hash == 0 ? 1 : hash;
+  }
+  return hash_;
+}
 
 /**
  * @brief Verifica si la cadena es válida respecto a su alfabeto
@@ -45,8 +265,8 @@ size_t String::Length() const { return content_.size(); }
  * @return true si todos los caracteres de la cadena están en el alfabeto
  */
 bool String::IsValid() const {
-  for (char c : content_) {
-    if (!alphabet_.Contains(c)) {
+  for (char c : View()) {
+    if (!alphabet_->Contains(c)) {
       return false;
     }
   }
@@ -57,7 +277,7 @@ bool String::IsValid() const {
  * @brief Verifica si la cadena está vacía
  * @return true si la cadena no contiene símbolos
  */
-bool String::IsEmpty() const { return content_.empty(); }
+bool String::IsEmpty() const { return length_ == 0; }
 
 /**
  * @brief Genera la cadena inversa (reversa)
@@ -65,24 +285,32 @@ bool String::IsEmpty() const { return content_.empty(); }
  * @return String Nueva cadena con los símbolos en orden inverso
  */
 String String::Reverse() const {
-  return String(std::string(content_.rbegin(), content_.rend()), alphabet_);
+  std::string_view content = View();
+  return String(std::string(content.rbegin(), content.rend()), alphabet_);
 }
 
 /**
- * @brief Genera el lenguaje de todos los prefijos de la cadena
- * Un prefijo es una subcadena que comienza desde el inicio
- * @return Language Lenguaje que contiene todos los prefijos
+ * @brief Genera el lenguaje de los prefijos de la cadena
+ * Un prefijo es una subcadena que comienza desde el inicio. Solo se
+ * construyen los prefijos cuya longitud está en el rango
+ * @param min_length Longitud mínima de los prefijos
+ * @param max_length Longitud máxima de los prefijos
+ * @return Language Lenguaje con los prefijos de longitud en el rango
  */
-Language String::Prefixes() const {
+Language String::Prefixes(size_t min_length, size_t max_length) const {
+  std::string_view content = View();
   Language prefixes_lang;
 
   // Añadir la cadena vacía como prefijo
-  String empty_string("", alphabet_);
-  prefixes_lang.AddString(empty_string);
+  if (min_length == 0) {
+    String empty_string("", alphabet_);
+    prefixes_lang.AddString(empty_string);
+  }
 
-  // Añadir todos los prefijos de la cadena
-  for (size_t i = 1; i <= content_.length(); ++i) {
-    String prefix(content_.substr(0, i), alphabet_);
+  // Añadir los prefijos de la cadena con longitud en el rango
+  size_t last = std::min(max_length, content.length());
+  for (size_t i = std::max<size_t>(min_length, 1); i <= last; ++i) {
+    String prefix(content.substr(0, i), alphabet_);
     prefixes_lang.AddString(prefix);
   }
 
@@ -90,66 +318,102 @@ Language String::Prefixes() const {
 }
 
 /**
- * @brief Genera el lenguaje de todos los sufijos de la cadena
- * Un sufijo es una subcadena que termina al final
- * @return Language Lenguaje que contiene todos los sufijos
+ * @brief Genera el lenguaje de los sufijos de la cadena
+ * Un sufijo es una subcadena que termina al final. Solo se construyen los
+ * sufijos cuya longitud está en el rango
+ * @param min_length Longitud mínima de los sufijos
+ * @param max_length Longitud máxima de los sufijos
+ * @return Language Lenguaje con los sufijos de longitud en el rango
  */
-Language String::Suffixes() const {
+Language String::Suffixes(size_t min_length, size_t max_length) const {
+  std::string_view content = View();
   Language suffixes_lang;
 
   // Añadir la cadena vacía como sufijo
-  String empty_string("", alphabet_);
-
-  suffixes_lang.AddString(empty_string);
+  if (min_length == 0) {
+    String empty_string("", alphabet_);
+    suffixes_lang.AddString(empty_string);
+  }
 
-  // Añadir todos los sufijos de la cadena
-  for (size_t i = 1; i <= content_.length(); ++i) {
-    String suffix(content_.substr(content_.length() - i), alphabet_);
+  // Añadir los sufijos de la cadena con longitud en el rango
+  size_t last = std::min(max_length, content.length());
+  for (size_t i = std::max<size_t>(min_length, 1); i <= last; ++i) {
+    String suffix(content.substr(content.length() - i), alphabet_);
     suffixes_lang.AddString(suffix);
   }
 
   return suffixes_lang;
 }
 
-/// @brief Subsecuencias de la cadena
-// devuelve todas las subsecuencias de una cadena y elimina las subcadenas
-/// @return Language que contiene todas las subsecuencias que no son subcadenas.
-Language String::Subsequences() const {
-  Language subsequences_lang;
-  Language subStrings = SubStrings();
-
-  // Añadir la cadena vacía como subsecuencia
-  String empty_string("", alphabet_);
-  subsequences_lang.AddString(empty_string);
-
-  size_t n = content_.length();
-
-  // Generar todas las subsecuencias utilizando un enfoque de conjunto de bits
-
-  for (size_t i = 1; i < (1 << n); ++i) {
-    std::string subseq;
-    for (size_t j = 0; j < n; ++j) {
-      if (i & (1 << j)) {
-        subseq += content_[j];
-      }
+/**
+ * @brief Genera las subsecuencias de la cadena que no son subcadenas
+ * Se recorre en profundidad el árbol de subsecuencias distintas: cada una
+ * se extiende con cada símbolo de la cadena tomando su primera aparición
+ * tras la posición actual (SubsequenceIndex::Next), así que cada
+ * subsecuencia se visita una sola vez y no hace falta eliminar duplicados.
+ * Las ramas que ya no pueden alcanzar la longitud mínima con los símbolos
+ * restantes no se exploran, y ninguna pasa de la máxima, de modo que el
+ * coste es proporcional al resultado y no a las 2^n selecciones
+ * @param min_length Longitud mínima de las subsecuencias
+ * @param max_length Longitud máxima de las subsecuencias
+ * @return Language Lenguaje con las subsecuencias de longitud en el rango
+ * que no son subcadenas
+ */
+Language String::Subsequences(size_t min_length, size_t max_length) const {
+  std::string_view content = View();
+  size_t n = content.length();
+
+  // Las subcadenas solo se consultan por pertenencia: no hace falta ordenarlas
+  // y deben seguir en memoria aunque haya límite de memoria. La cadena vacía
+  // es subcadena, así que nunca forma parte del resultado
+  Language subStrings(Language::Backend::kHashed);
+  subStrings.SetMemoryLimit(0);
+  AddSubStrings(subStrings, std::max<size_t>(min_length, 1), max_length);
+
+  // El resultado se ordena una sola vez al escribirlo
+  Language output_lang(Language::Backend::kHashed);
+
+  // Símbolos distintos de la cadena, en orden
+  std::array<bool, 256> present{};
+  for (char c : content) {
+    present[static_cast<unsigned char>(c)] = true;
+  }
+  std::string symbols;
+  for (size_t c = 0; c < present.size(); ++c) {
+    if (present[c]) {
+      symbols += static_cast<char>(c);
     }
-    String subsequence(subseq, alphabet_);
-    subsequences_lang.AddString(subsequence);
   }
 
-  Language output_lang;
-
-  for (const auto& str : subsequences_lang.GetStrings()) {
-    bool isSubstring = false;
-    for (const auto& subStr : subStrings.GetStrings()) {
-      if (str == subStr) {
-        isSubstring = true;
+  // Cada marco guarda la posición desde la que se busca el siguiente símbolo
+  // y el siguiente símbolo a probar; la subsecuencia actual es word
+  SubsequenceIndex index = IndexSubsequences();
+  std::string word;
+  std::vector<std::pair<size_t, size_t>> stack = {{0, 0}};
+  while (!stack.empty()) {
+    auto& [start, symbol] = stack.back();
+    if (symbol == symbols.length() || word.length() >= max_length) {
+      stack.pop_back();
+      if (!word.empty()) {
+        word.pop_back();
       }
+      continue;
     }
 
-    if (!isSubstring) {
-      output_lang.AddString(str);
+    char c = symbols[symbol++];
+    size_t position = index.Next(start, c);
+    if (position == SubsequenceIndex::npos ||
+        word.length() + n - position < min_length) {
+      continue;
+    }
+    word += c;
+    if (word.length() >= min_length) {
+      String subsequence(word, alphabet_);
+      if (!subStrings.Contains(subsequence)) {
+        output_lang.AddString(subsequence);
+      }
     }
+    stack.push_back({position + 1, 0});
   }
 
   return output_lang;
@@ -161,21 +425,355 @@ Language String::Subsequences() const {
 
 Language String::SubStrings() const {
   Language substrings_lang;
+  AddSubStrings(substrings_lang);
+  return substrings_lang;
+}
+
+/**
+ * @brief Añade a un lenguaje las subcadenas de la cadena en un rango de
+ * longitudes
+ * @param lang Lenguaje donde añadir las subcadenas
+ * @param min_length Longitud mínima (0 incluye la cadena vacía)
+ * @param max_length Longitud máxima
+ */
+void String::AddSubStrings(Language& lang, size_t min_length,
+                           size_t max_length) const {
+  std::string_view content = View();
 
   // Añadir la cadena vacía como subcadena
-  String empty_string("", alphabet_);
-  substrings_lang.AddString(empty_string);
+  if (min_length == 0) {
+    String empty_string("", alphabet_);
+    lang.AddString(empty_string);
+  }
 
-  size_t n = content_.length();
+  size_t n = content.length();
+  size_t first = std::max<size_t>(min_length, 1);
+  size_t last = std::min(max_length, n);
 
-  // Generar todas las subcadenas posibles
+  // Generar las subcadenas con longitud en el rango
   for (size_t i = 0; i < n; ++i) {
-    for (size_t j = i + 1; j <= n; ++j) {
-      String substring(content_.substr(i, j - i), alphabet_);
-      substrings_lang.AddString(substring);
+    for (size_t length = first; length <= last && i + length <= n; ++length) {
+      String substring(content.substr(i, length), alphabet_);
+      lang.AddString(substring);
     }
   }
-  return substrings_lang;
+}
+
+/**
+ * @brief Calcula la subcadena palíndroma más larga (algoritmo de Manacher)
+ * Trabaja sobre la cadena intercalada con separadores virtuales, de forma que
+ * los palíndromos de longitud par e impar se tratan igual, en tiempo O(n)
+ * @return String Palíndromo más largo; el de menor posición si hay empate
+ */
+String String::LongestPalindrome() const {
+  std::string_view content = View();
+  size_t n = content.length();
+  if (n == 0) {
+    return String("", alphabet_);
+  }
+
+  // radius[i]: radio del palíndromo centrado en la posición i de la cadena
+  // intercalada (longitud 2n + 1); las posiciones pares son separadores
+  size_t m = 2 * n + 1;
+  std::vector<size_t> radius(m, 0);
+  auto symbol_at = [content](size_t i) -> int {
+    return (i % 2 == 0) ? -1 : static_cast<unsigned char>(content[i / 2]);
+  };
+
+  size_t center = 0;
+  size_t right = 0;
+  size_t best_center = 0;
+  for (size_t i = 0; i < m; ++i) {
+    if (i < right) {
+      radius[i] = std::min(right - i, radius[2 * center - i]);
+    }
+    while (i >= radius[i] + 1 && i + radius[i] + 1 < m &&
+           symbol_at(i - radius[i] - 1) == symbol_at(i + radius[i] + 1)) {
+      ++radius[i];
+    }
+    if (i + radius[i] > right) {
+      center = i;
+      right = i + radius[i];
+    }
+    if (radius[i] > radius[best_center]) {
+      best_center = i;
+    }
+  }
+
+  // El radio en la cadena intercalada coincide con la longitud real
+  size_t length = radius[best_center];
+  size_t start = (best_center - length) / 2;
+  return String(content.substr(start, length), alphabet_);
+}
+
+/**
+ * @brief Calcula la subcadena más larga que aparece al menos dos veces
+ * Construye el array de sufijos por duplicación de prefijos con ordenación por
+ * cubetas (O(n log n)) y el array LCP con el algoritmo de Kasai (O(n)). La
+ * subcadena repetida más larga es el máximo del array LCP
+ * @return String Subcadena repetida más larga, o la cadena vacía si no hay
+ */
+String String::LongestRepeatedSubstring() const {
+  std::string_view content = View();
+  size_t n = content.length();
+  if (n < 2) {
+    return String("", alphabet_);
+  }
+
+  // Array de sufijos: rank[i] es la clase del sufijo i según sus primeros
+  // k símbolos; en cada ronda se duplica k ordenando por (rank[i], rank[i+k])
+  std::vector<size_t> suffix_array(n);
+  std::vector<size_t> rank(n);
+  std::vector<size_t> buffer(n);
+  for (size_t i = 0; i < n; ++i) {
+    suffix_array[i] = i;
+    rank[i] = static_cast<unsigned char>(content[i]) + 1;
+  }
+  size_t classes = 257;
+  std::vector<size_t> count;
+  for (size_t k = 1;; k <<= 1) {
+    auto second_key = [&](size_t i) { return i + k < n ? rank[i + k] : 0; };
+
+    // Ordenación estable por cubetas: primero la clave secundaria y luego la
+    // principal (radix sort de dos pasadas)
+    count.assign(classes + 1, 0);
+    for (size_t i = 0; i < n; ++i) ++count[second_key(i)];
+    for (size_t c = 1; c <= classes; ++c) count[c] += count[c - 1];
+    for (size_t i = n; i-- > 0;) buffer[--count[second_key(i)]] = i;
+
+    count.assign(classes + 1, 0);
+    for (size_t i = 0; i < n; ++i) ++count[rank[i]];
+    for (size_t c = 1; c <= classes; ++c) count[c] += count[c - 1];
+    for (size_t i = n; i-- > 0;) {
+      suffix_array[--count[rank[buffer[i]]]] = buffer[i];
+    }
+
+    // Reasignar clases a partir del nuevo orden
+    buffer[suffix_array[0]] = 1;
+    for (size_t i = 1; i < n; ++i) {
+      size_t prev = suffix_array[i - 1];
+      size_t cur = suffix_array[i];
+      bool same =
+          rank[prev] == rank[cur] && second_key(prev) == second_key(cur);
+      buffer[cur] = buffer[prev] + (same ? 0 : 1);
+    }
+    rank.swap(buffer);
+    classes = rank[suffix_array[n - 1]];
+    if (classes == n) break;  // Todos los sufijos ya son distinguibles
+  }
+
+  // Array LCP (Kasai): lcp de cada sufijo con el anterior en el orden
+  std::vector<size_t> inverse(n);
+  for (size_t i = 0; i < n; ++i) inverse[suffix_array[i]] = i;
+
+  size_t best_length = 0;
+  size_t best_start = 0;
+  size_t h = 0;
+  for (size_t i = 0; i < n; ++i) {
+    if (inverse[i] == 0) {
+      h = 0;
+      continue;
+    }
+    size_t j = suffix_array[inverse[i] - 1];
+    while (i + h < n && j + h < n && content[i + h] == content[j + h]) {
+      ++h;
+    }
+    if (h > best_length) {
+      best_length = h;
+      best_start = i;
+    }
+    if (h > 0) --h;
+  }
+
+  return String(content.substr(best_start, best_length), alphabet_);
+}
+
+/**
+ * @brief Calcula el periodo más pequeño de la cadena
+ * El periodo mínimo es la longitud menos la del borde más largo
+ * @return size_t Menor p tal que content[i] == content[i + p] para todo i
+ */
+size_t String::SmallestPeriod() const {
+  std::string_view content = View();
+  if (content.empty()) {
+    return 0;
+  }
+  return content.length() - BorderArray().back();
+}
+
+/**
+ * @brief Calcula el array de bordes (función de prefijos) de la cadena
+ * Algoritmo de Knuth-Morris-Pratt, en tiempo O(n)
+ * @return std::vector<size_t> Longitud del borde más largo de cada prefijo
+ */
+std::vector<size_t> String::BorderArray() const {
+  std::string_view content = View();
+  size_t n = content.length();
+  std::vector<size_t> border(n, 0);
+  for (size_t i = 1; i < n; ++i) {
+    size_t k = border[i - 1];
+    while (k > 0 && content[i] != content[k]) {
+      k = border[k - 1];
+    }
+    if (content[i] == content[k]) {
+      ++k;
+    }
+    border[i] = k;
+  }
+  return border;
+}
+
+/**
+ * @brief Construye el índice de siguientes apariciones de la cadena
+ * @return SubsequenceIndex Índice de subsecuencias de la cadena
+ */
+SubsequenceIndex String::IndexSubsequences() const {
+  return SubsequenceIndex(*this);
+}
+
+/**
+ * @brief Cuenta las apariciones de cada símbolo de la cadena
+ * Se reparten los símbolos consecutivos entre cuatro tablas de contadores y
+ * se suman al final. Con una sola tabla, una racha del mismo símbolo hace
+ * que cada incremento espere al anterior sobre el mismo contador; con
+ * cuatro, los incrementos de cada grupo de cuatro símbolos son independientes
+ * @return std::array<size_t, 256> Apariciones de cada byte
+ */
+std::array<size_t, 256> String::SymbolCounts() const {
+  std::string_view content = View();
+  const unsigned char* data =
+      reinterpret_cast<const unsigned char*>(content.data());
+  size_t n = content.length();
+
+  // length_ es de 32 bits, así que ningún contador se desborda
+  std::array<std::array<uint32_t, 256>, 4> tables{};
+  size_t i = 0;
+  for (; i + 4 <= n; i += 4) {
+    ++tables[0][data[i]];
+    ++tables[1][data[i + 1]];
+    ++tables[2][data[i + 2]];
+    ++tables[3][data[i + 3]];
+  }
+  for (; i < n; ++i) {
+    ++tables[0][data[i]];
+  }
+
+  std::array<size_t, 256> counts{};
+  for (size_t c = 0; c < counts.size(); ++c) {
+    counts[c] = size_t{tables[0][c]} + tables[1][c] + tables[2][c] +
+                tables[3][c];
+  }
+  return counts;
+}
+
+/**
+ * @brief Calcula la distancia de edición (Levenshtein) con otra cadena
+ * La cadena más corta actúa como patrón (filas) y la otra se recorre símbolo
+ * a símbolo. Cada columna de la matriz se guarda como diferencias verticales
+ * positivas (pv) y negativas (mv) entre filas consecutivas; el acarreo
+ * horizontal entre bloques enlaza las palabras, de modo que una columna
+ * cuesta O(m / 64). La puntuación se sigue en la última fila del patrón
+ * @param other Cadena con la que comparar
+ * @return size_t Número mínimo de inserciones, borrados y sustituciones
+ */
+size_t String::EditDistance(const String& other) const {
+  std::string_view pattern = View();
+  std::string_view text = other.View();
+  if (pattern.length() > text.length()) {
+    std::swap(pattern, text);
+  }
+  size_t m = pattern.length();
+  if (m == 0) {
+    return text.length();
+  }
+
+  PatternMasks masks(pattern);
+  size_t blocks = masks.Blocks();
+  std::vector<uint64_t> pv(blocks, ~uint64_t{0});  // D[i][0] = i
+  std::vector<uint64_t> mv(blocks, 0);
+  uint64_t last_bit = uint64_t{1} << ((m - 1) % kWordBits);
+  size_t score = m;
+
+  for (char c : text) {
+    const uint64_t* eq_blocks = masks.Masks(c);
+    int carry = 1;  // D[0][j] = j: la fila 0 siempre aumenta en 1
+    for (size_t b = 0; b < blocks; ++b) {
+      uint64_t eq = eq_blocks[b];
+      uint64_t carry_negative = carry < 0 ? 1 : 0;
+      uint64_t xv = eq | mv[b];
+      eq |= carry_negative;
+      uint64_t xh = (((eq & pv[b]) + pv[b]) ^ pv[b]) | eq;
+      uint64_t ph = mv[b] | ~(xh | pv[b]);
+      uint64_t mh = pv[b] & xh;
+
+      if (b + 1 == blocks) {
+        // Diferencia horizontal en la última fila del patrón
+        score += (ph & last_bit) ? 1 : 0;
+        score -= (mh & last_bit) ? 1 : 0;
+      }
+      int carry_out = static_cast<int>(ph >> (kWordBits - 1)) -
+                      static_cast<int>(mh >> (kWordBits - 1));
+
+      ph <<= 1;
+      mh <<= 1;
+      mh |= carry_negative;
+      ph |= carry > 0 ? 1 : 0;
+      pv[b] = mh | ~(xv | ph);
+      mv[b] = ph & xv;
+      carry = carry_out;
+    }
+  }
+  return score;
+}
+
+/**
+ * @brief Calcula la longitud de la subsecuencia común más larga
+ * El vector v tiene un bit a 0 por cada símbolo del patrón emparejado; con
+ * cada símbolo c del texto se actualiza como v = (v + u) | (v - u), con
+ * u = v & M[c]. Como u es subconjunto de v, v - u no tiene préstamos y solo
+ * la suma necesita propagar el acarreo entre bloques
+ * @param other Cadena con la que comparar
+ * @return size_t Longitud de la subsecuencia común más larga
+ */
+size_t String::LcsLength(const String& other) const {
+  std::string_view pattern = View();
+  std::string_view text = other.View();
+  if (pattern.length() > text.length()) {
+    std::swap(pattern, text);
+  }
+  size_t m = pattern.length();
+  if (m == 0) {
+    return 0;
+  }
+
+  PatternMasks masks(pattern);
+  size_t blocks = masks.Blocks();
+  std::vector<uint64_t> v(blocks, ~uint64_t{0});
+
+  for (char c : text) {
+    const uint64_t* match = masks.Masks(c);
+    uint64_t carry = 0;
+    for (size_t b = 0; b < blocks; ++b) {
+      uint64_t u = v[b] & match[b];
+      uint64_t sum = v[b] + u;
+      uint64_t next_carry = sum < v[b] ? 1 : 0;
+      sum += carry;
+      next_carry |= (carry != 0 && sum == 0) ? 1 : 0;
+      v[b] = sum | (v[b] - u);
+      carry = next_carry;
+    }
+  }
+
+  // Los ceros de v dentro de las m filas del patrón son la longitud del LCS
+  size_t ones = 0;
+  for (size_t b = 0; b < blocks; ++b) {
+    uint64_t word = v[b];
+    if (b + 1 == blocks && m % kWordBits != 0) {
+      word &= (uint64_t{1} << (m % kWordBits)) - 1;
+    }
+    ones += static_cast<size_t>(__builtin_popcountll(word));
+  }
+  return m - ones;
 }
 
 /**
@@ -186,17 +784,21 @@ Language String::SubStrings() const {
  * contrario
  */
 bool String::operator==(const String& other) const {
-  return content_ == other.content_;
+  // Con ambos hashes ya calculados, si difieren las cadenas son distintas
+  if (hash_ != 0 && other.hash_ != 0 && hash_ != other.hash_) {
+    return false;
+  }
+  return View() == other.View();
 }
 
 /**
  * @brief Operador de comparación lexicográfica
- * Utiliza el orden lexicográfico estándar de std::string
+ * Utiliza el orden lexicográfico estándar de std::string_view
  * @param other Cadena a comparar
  * @return true si esta cadena es lexicográficamente menor que other
  */
 bool String::operator<(const String& other) const {
-  return content_ < other.content_;
+  return View() < other.View();
 }
 
 /**
@@ -207,10 +809,10 @@ bool String::operator<(const String& other) const {
  * @return std::ostream& Referencia al flujo de salida
  */
 std::ostream& operator<<(std::ostream& os, const String& str) {
-  if (str.content_.empty()) {
+  if (str.length_ == 0) {
     os << "&";
   } else {
-    os << str.content_;
+    os << str.View();
   }
   return os;
 }
@@ -223,6 +825,10 @@ std::ostream& operator<<(std::ostream& os, const String& str) {
  * @return std::istream& Referencia al flujo de entrada
  */
 std::istream& operator>>(std::istream& is, String& str) {
-  is >> str.content_;
+  std::string content;
+  if (is >> content) {
+    str.Release();
+    str.Assign(content);
+  }
   return is;
 }
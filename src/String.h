@@ -23,17 +23,29 @@
 //
 // Historial de revisiones
 // 21/09/2025 - Creación (primera versión) del código
+// 19/10/2026 - Operaciones de palíndromos, repeticiones, periodos y bordes
+// 19/10/2026 - Consultas de subsecuencias con SubsequenceIndex
+// 19/10/2026 - Hash de la cadena en caché para Language con tabla hash
+// 19/10/2026 - Representación compacta para cadenas cortas
+// 19/10/2026 - Prefijos, sufijos y subsecuencias con rango de longitudes
+// 19/10/2026 - Distancia de edición y LCS con paralelismo de bits
+// 19/10/2026 - Recuento de símbolos para el opcode 20
 
 #ifndef STRING_H
 #define STRING_H
 
+#include <array>
+#include <cstdint>
 #include <iostream>
+#include <limits>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include "Alphabet.h"
 
 class Language;  // forward declaration
+class SubsequenceIndex;  // forward declaration
 
 /**
  * @brief Clase que representa una cadena (string) sobre un alfabeto específico
@@ -42,20 +54,64 @@ class Language;  // forward declaration
  * implementa las operaciones básicas sobre cadenas utilizadas en teoría de
  * autómatas y lenguajes formales, como obtener prefijos, sufijos, inversas,
  * etc.
+ *
+ * La representación es compacta (32 bytes): el alfabeto se comparte entre
+ * todas las cadenas que lo usan y los contenidos de hasta kInlineCapacity
+ * símbolos se guardan en la propia cadena, sin memoria dinámica.
  */
 class String {
+  friend class Language;  // Reconstruye cadenas con el alfabeto compartido
+
  private:
-  std::string
-      content_;        ///< Contenido de la cadena como secuencia de caracteres
-  Alphabet alphabet_;  ///< Alfabeto sobre el cual está definida la cadena
+  /// Símbolos que caben en la propia cadena sin reservar memoria dinámica
+  static constexpr size_t kInlineCapacity = 16;
+
+  const Alphabet* alphabet_;  ///< Alfabeto compartido (Alphabet::Intern)
+  union {
+    char inline_[kInlineCapacity];  ///< Contenido si cabe en la cadena
+    char* heap_;                    ///< Contenido en memoria dinámica si no
+  };
+  uint32_t length_ = 0;        ///< Número de símbolos de la cadena
+  mutable uint32_t hash_ = 0;  ///< Hash del contenido, 0 si aún no se calculó
+
+  /**
+   * @brief Constructor interno a partir de un alfabeto ya compartido
+   * @param content Contenido de la cadena
+   * @param alphabet Alfabeto obtenido de Alphabet::Intern
+   */
+  String(std::string_view content, const Alphabet* alphabet);
+
+  /**
+   * @brief Copia un contenido en el almacenamiento de la cadena
+   * @param content Contenido a copiar; la cadena no debe tener contenido
+   */
+  void Assign(std::string_view content);
+
+  /**
+   * @brief Libera la memoria dinámica del contenido, si la hay
+   */
+  void Release();
+
+  /**
+   * @brief Añade a un lenguaje las subcadenas de la cadena en un rango de
+   * longitudes
+   * @param lang Lenguaje donde añadir las subcadenas
+   * @param min_length Longitud mínima (0 incluye la cadena vacía)
+   * @param max_length Longitud máxima
+   */
+  void AddSubStrings(Language& lang, size_t min_length = 0,
+                     size_t max_length = kNoMaxLength) const;
 
  public:
+  /// Longitud máxima por defecto de los generadores: sin límite
+  static constexpr size_t kNoMaxLength = std::numeric_limits<size_t>::max();
+
   // ==================== CONSTRUCTORES ====================
 
   /**
    * @brief Constructor por defecto que crea una cadena vacía
    */
-  String() = default;
+  String();
 
   /**
    * @brief Constructor que inicializa la cadena con contenido y alfabeto
@@ -65,6 +121,37 @@ class String {
    */
   String(const std::string& content, const Alphabet& alphabet);
 
+  /**
+   * @brief Constructor de copia
+   * @param other Cadena a copiar
+   */
+  String(const String& other);
+
+  /**
+   * @brief Constructor de movimiento
+   * @param other Cadena cuyo contenido se toma
+   */
+  String(String&& other) noexcept;
+
+  /**
+   * @brief Destructor que libera el contenido en memoria dinámica
+   */
+  ~String();
+
+  /**
+   * @brief Asignación por copia
+   * @param other Cadena a copiar
+   * @return String& Referencia a esta cadena
+   */
+  String& operator=(const String& other);
+
+  /**
+   * @brief Asignación por movimiento
+   * @param other Cadena cuyo contenido se toma
+   * @return String& Referencia a esta cadena
+   */
+  String& operator=(String&& other) noexcept;
+
   // ==================== MÉTODOS DE ACCESO ====================
 
   /**
@@ -73,11 +160,17 @@ class String {
    */
   std::string GetContent() const;
 
+  /**
+   * @brief Obtiene una vista del contenido sin copiarlo
+   * @return std::string_view Contenido, válido mientras viva la cadena
+   */
+  std::string_view View() const;
+
   /**
    * @brief Obtiene el alfabeto sobre el cual está definida la cadena
-   * @return Alphabet Alfabeto de la cadena
+   * @return const Alphabet& Alfabeto de la cadena
    */
-  Alphabet GetAlphabet() const;
+  const Alphabet& GetAlphabet() const;
 
   // ==================== MÉTODOS DE ANÁLISIS ====================
 
@@ -87,6 +180,13 @@ class String {
    */
   size_t Length() const;
 
+  /**
+   * @brief Obtiene el hash del contenido de la cadena
+   * Se calcula la primera vez y queda guardado en la propia cadena
+   * @return size_t Hash del contenido
+   */
+  size_t Hash() const;
+
   /**
    * @brief Verifica si la cadena es válida respecto a su alfabeto
    * @return true si todos los caracteres de la cadena están en el alfabeto
@@ -106,22 +206,96 @@ class String {
   String Reverse() const;
 
   /**
-   * @brief Genera el lenguaje de todos los prefijos de la cadena
-   * @return Language Lenguaje que contiene todos los prefijos
+   * @brief Genera el lenguaje de los prefijos de la cadena
+   * @param min_length Longitud mínima de los prefijos
+   * @param max_length Longitud máxima de los prefijos
+   * @return Language Lenguaje con los prefijos de longitud en el rango
    */
-  Language Prefixes() const;
+  Language Prefixes(size_t min_length = 0,
+                    size_t max_length = kNoMaxLength) const;
 
   /**
-   * @brief Genera el lenguaje de todos los sufijos de la cadena
-   * @return Language Lenguaje que contiene todos los sufijos
+   * @brief Genera el lenguaje de los sufijos de la cadena
+   * @param min_length Longitud mínima de los sufijos
+   * @param max_length Longitud máxima de los sufijos
+   * @return Language Lenguaje con los sufijos de longitud en el rango
    */
-  Language Suffixes() const;
-
+  Language Suffixes(size_t min_length = 0,
+                    size_t max_length = kNoMaxLength) const;
 
-  Language Subsequences() const;
+  /**
+   * @brief Genera las subsecuencias de la cadena que no son subcadenas
+   * @param min_length Longitud mínima de las subsecuencias
+   * @param max_length Longitud máxima de las subsecuencias
+   * @return Language Lenguaje con las subsecuencias de longitud en el rango
+   * que no son subcadenas
+   */
+  Language Subsequences(size_t min_length = 0,
+                        size_t max_length = kNoMaxLength) const;
 
   Language SubStrings() const;
 
+  // ==================== ANÁLISIS LINEAL ====================
+
+  /**
+   * @brief Calcula la subcadena palíndroma más larga (algoritmo de Manacher)
+   * @return String Palíndromo más largo; el de menor posición si hay empate
+   */
+  String LongestPalindrome() const;
+
+  /**
+   * @brief Calcula la subcadena más larga que aparece al menos dos veces
+   * Usa un array de sufijos junto con su array LCP (algoritmo de Kasai)
+   * @return String Subcadena repetida más larga, o la cadena vacía si no hay
+   */
+  String LongestRepeatedSubstring() const;
+
+  /**
+   * @brief Calcula el periodo más pequeño de la cadena
+   * @return size_t Menor p tal que content[i] == content[i + p] para todo i
+   */
+  size_t SmallestPeriod() const;
+
+  /**
+   * @brief Calcula el array de bordes (función de prefijos) de la cadena
+   * @return std::vector<size_t> Longitud del borde más largo de cada prefijo
+   */
+  std::vector<size_t> BorderArray() const;
+
+  /**
+   * @brief Construye el índice de siguientes apariciones de la cadena
+   * El índice se construye una vez y responde después cada consulta de
+   * subsecuencia sin recorrer la cadena; quien lo use debe incluir
+   * SubsequenceIndex.h y conservarlo para las consultas repetidas
+   * @return SubsequenceIndex Índice de subsecuencias de la cadena
+   */
+  SubsequenceIndex IndexSubsequences() const;
+
+  /**
+   * @brief Cuenta las apariciones de cada símbolo de la cadena
+   * @return std::array<size_t, 256> Apariciones de cada byte
+   */
+  std::array<size_t, 256> SymbolCounts() const;
+
+  // ==================== COMPARACIÓN ENTRE CADENAS ====================
+
+  /**
+   * @brief Calcula la distancia de edición (Levenshtein) con otra cadena
+   * Usa el algoritmo de vectores de bits de Myers, que procesa 64 filas de
+   * la matriz de programación dinámica por palabra de máquina
+   * @param other Cadena con la que comparar
+   * @return size_t Número mínimo de inserciones, borrados y sustituciones
+   */
+  size_t EditDistance(const String& other) const;
+
+  /**
+   * @brief Calcula la longitud de la subsecuencia común más larga
+   * Usa el algoritmo de paralelismo de bits de Allison-Dix / Hyyrö
+   * @param other Cadena con la que comparar
+   * @return size_t Longitud de la subsecuencia común más larga
+   */
+  size_t LcsLength(const String& other) const;
+
   // ==================== SOBRECARGA DE OPERADORES ====================
 
   /**
@@ -156,4 +330,14 @@ class String {
   friend std::istream& operator>>(std::istream& is, String& str);
 };
 
+/**
+ * @brief Especialización de std::hash para usar String en tablas hash
+ */
+namespace std {
+template <>
+struct hash<String> {
+  size_t operator()(const String& str) const noexcept { return str.Hash(); }
+};
+}  // namespace std
+
 #endif
@@ -0,0 +1,117 @@
+/**
+ * @file StringHashSet.cc
+ * @brief Implementación de la clase StringHashSet
+ * @author Hector Luis Mariño Fernandez
+ * @date 19 de octubre de 2026
+ */
+
+// Universidad de La Laguna
+// Escuela Superior de Ingeniería y Tecnología
+// Grado en Ingeniería Informática
+// Asignatura: Computabilidad y Algoritmia
+// Curso: 2º
+// Práctica 2: Cadenas y lenguajes
+// Autor: Hector Luis Mariño Fernandez
+// Correo: alu0100595604@ull.edu.es
+// Fecha: 19/10/2026
+// Archivo StringHashSet.cc: implementación de la clase StringHashSet.
+// Contiene la inserción, búsqueda y crecimiento de la tabla hash de
+// direccionamiento abierto
+// Referencias:
+// https://en.wikipedia.org/wiki/Open_addressing
+//
+// Historial de revisiones
+// 19/10/2026 - Creación (primera versión) del código
+
+#include "StringHashSet.h"
+
+#include <functional>
+
+namespace {
+
+/// Tamaño inicial de la tabla (potencia de dos)
+constexpr size_t kInitialSlots = 16;
+
+}  // namespace
+
+/**
+ * @brief Añade una cadena si no estaba ya en el conjunto
+ * La tabla se mantiene como mucho medio llena para que las secuencias de
+ * sondeo sean cortas
+ * @param str Cadena a añadir
+ * @return true si se añadió, false si ya estaba
+ */
+bool StringHashSet::Insert(const String& str) {
+  if (2 * (values_.size() + 1) > slots_.size()) {
+    Grow();
+  }
+  size_t slot = FindSlot(str);
+  if (slots_[slot] != kEmpty) {
+    return false;
+  }
+  values_.push_back(str);
+  slots_[slot] = static_cast<uint32_t>(values_.size());
+  return true;
+}
+
+/**
+ * @brief Elimina todas las cadenas del conjunto
+ */
+void StringHashSet::Clear() {
+  values_.clear();
+  slots_.clear();
+}
+
+/**
+ * @brief Comprueba si una cadena pertenece al conjunto
+ * @param str Cadena a buscar
+ * @return true si la cadena está en el conjunto
+ */
+bool StringHashSet::Contains(const String& str) const {
+  return !slots_.empty() && slots_[FindSlot(str)] != kEmpty;
+}
+
+/**
+ * @brief Obtiene el número de cadenas del conjunto
+ * @return size_t Número de cadenas
+ */
+size_t StringHashSet::Size() const { return values_.size(); }
+
+/**
+ * @brief Obtiene las cadenas del conjunto en orden de inserción
+ * @return const std::vector<String>& Cadenas del conjunto
+ */
+const std::vector<String>& StringHashSet::Values() const { return values_; }
+
+/**
+ * @brief Busca la posición de la tabla de una cadena o donde insertarla
+ * Sondeo lineal desde la posición indicada por el hash; la tabla nunca está
+ * llena, así que siempre se llega a una posición libre
+ * @param str Cadena a buscar
+ * @return size_t Posición que contiene la cadena o primera posición libre
+ */
+size_t StringHashSet::FindSlot(const String& str) const {
+  size_t mask = slots_.size() - 1;
+  size_t slot = std::hash<String>()(str) & mask;
+  while (slots_[slot] != kEmpty && !(values_[slots_[slot] - 1] == str)) {
+    slot = (slot + 1) & mask;
+  }
+  return slot;
+}
+
+/**
+ * @brief Duplica la tabla y recoloca todos los índices
+ * Los hashes ya están guardados en las cadenas, así que no se recalculan
+ */
+void StringHashSet::Grow() {
+  size_t capacity = slots_.empty() ? kInitialSlots : 2 * slots_.size();
+  slots_.assign(capacity, kEmpty);
+  size_t mask = capacity - 1;
+  for (size_t i = 0; i < values_.size(); ++i) {
+    size_t slot = std::hash<String>()(values_[i]) & mask;
+    while (slots_[slot] != kEmpty) {
+      slot = (slot + 1) & mask;
+    }
+    slots_[slot] = static_cast<uint32_t>(i + 1);
+  }
+}
@@ -0,0 +1,106 @@
+/**
+ * @file StringHashSet.h
+ * @brief Definición de la clase StringHashSet, conjunto de cadenas por hash
+ * @author Hector Luis Mariño Fernandez
+ * @date 19 de octubre de 2026
+ */
+
+// Universidad de La Laguna
+// Escuela Superior de Ingeniería y Tecnología
+// Grado en Ingeniería Informática
+// Asignatura: Computabilidad y Algoritmia
+// Curso: 2º
+// Práctica 2: Cadenas y lenguajes
+// Autor: Hector Luis Mariño Fernandez
+// Correo: alu0100595604@ull.edu.es
+// Fecha: 19/10/2026
+// Archivo StringHashSet.h: definición de la clase StringHashSet.
+// Contiene una tabla hash de direccionamiento abierto para guardar
+// cadenas sin orden, pensada para consultas de pertenencia
+// Referencias:
+// https://en.wikipedia.org/wiki/Open_addressing
+//
+// Historial de revisiones
+// 19/10/2026 - Creación (primera versión) del código
+
+#ifndef STRINGHASHSET_H
+#define STRINGHASHSET_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "String.h"
+
+/**
+ * @brief Conjunto de cadenas sobre una tabla hash de direccionamiento abierto
+ *
+ * Las cadenas se guardan de forma contigua en orden de inserción y la tabla
+ * solo contiene índices a ellas, con sondeo lineal. Cada búsqueda compara
+ * primero el hash guardado en la propia cadena, por lo que casi nunca hace
+ * falta comparar contenidos. No mantiene ningún orden entre las cadenas.
+ */
+class StringHashSet {
+ public:
+  // ==================== CONSTRUCTORES ====================
+
+  /**
+   * @brief Constructor por defecto que crea un conjunto vacío
+   */
+  StringHashSet() = default;
+
+  // ==================== MÉTODOS DE MODIFICACIÓN ====================
+
+  /**
+   * @brief Añade una cadena si no estaba ya en el conjunto
+   * @param str Cadena a añadir
+   * @return true si se añadió, false si ya estaba
+   */
+  bool Insert(const String& str);
+
+  /**
+   * @brief Elimina todas las cadenas del conjunto
+   */
+  void Clear();
+
+  // ==================== MÉTODOS DE CONSULTA ====================
+
+  /**
+   * @brief Comprueba si una cadena pertenece al conjunto
+   * @param str Cadena a buscar
+   * @return true si la cadena está en el conjunto
+   */
+  bool Contains(const String& str) const;
+
+  /**
+   * @brief Obtiene el número de cadenas del conjunto
+   * @return size_t Número de cadenas
+   */
+  size_t Size() const;
+
+  /**
+   * @brief Obtiene las cadenas del conjunto en orden de inserción
+   * @return const std::vector<String>& Cadenas del conjunto
+   */
+  const std::vector<String>& Values() const;
+
+ private:
+  static constexpr uint32_t kEmpty = 0;  ///< Marca de posición libre
+
+  std::vector<String> values_;  ///< Cadenas en orden de inserción
+  std::vector<uint32_t> slots_;  ///< Índice + 1 en values_, o kEmpty
+
+  /**
+   * @brief Busca la posición de la tabla de una cadena o donde insertarla
+   * @param str Cadena a buscar
+   * @return size_t Posición que contiene la cadena o primera posición libre
+   */
+  size_t FindSlot(const String& str) const;
+
+  /**
+   * @brief Duplica la tabla y recoloca todos los índices
+   */
+  void Grow();
+};
+
+#endif
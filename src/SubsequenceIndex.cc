@@ -0,0 +1,157 @@
+/**
+ * @file SubsequenceIndex.cc
+ * @brief Implementación de la clase SubsequenceIndex
+ * @author Hector Luis Mariño Fernandez
+ * @date 19 de octubre de 2026
+ */
+
+// Universidad de La Laguna
+// Escuela Superior de Ingeniería y Tecnología
+// Grado en Ingeniería Informática
+// Asignatura: Computabilidad y Algoritmia
+// Curso: 2º
+// Práctica 2: Cadenas y lenguajes
+// Autor: Hector Luis Mariño Fernandez
+// Correo: alu0100595604@ull.edu.es
+// Fecha: 19/10/2026
+// Archivo SubsequenceIndex.cc: implementación de la clase SubsequenceIndex.
+// Contiene la construcción de la tabla de siguientes apariciones y la
+// resolución, secuencial o en paralelo, de consultas de subsecuencias
+// Referencias:
+// https://en.wikipedia.org/wiki/Subsequence
+//
+// Historial de revisiones
+// 19/10/2026 - Creación (primera versión) del código
+
+#include "SubsequenceIndex.h"
+
+#include <algorithm>
+#include <string_view>
+#include <thread>
+
+#include "Operations.h"
+
+namespace {
+
+/// Consultas mínimas por hilo para que compense lanzar hilos adicionales
+constexpr size_t kMinQueriesPerThread = 4096;
+
+}  // namespace
+
+/**
+ * @brief Construye el índice sobre el contenido de una cadena
+ * Las columnas corresponden solo a los símbolos que aparecen en la cadena.
+ * La tabla se rellena de derecha a izquierda: la fila i es la fila i + 1 con
+ * la columna de s[i] apuntando a i. La fila n indica "no aparece" con el
+ * valor n
+ * @param str Cadena sobre la que se harán las consultas
+ */
+SubsequenceIndex::SubsequenceIndex(const String& str) {
+  std::string_view content = str.View();
+  length_ = content.length();
+
+  symbol_index_.fill(kNoSymbol);
+  for (char c : content) {
+    int& index = symbol_index_[static_cast<unsigned char>(c)];
+    if (index == kNoSymbol) {
+      index = static_cast<int>(symbol_count_++);
+    }
+  }
+
+  if ((length_ + 1) * symbol_count_ <= kMaxTableEntries) {
+    next_.assign((length_ + 1) * symbol_count_,
+                 static_cast<uint32_t>(length_));
+    for (size_t i = length_; i-- > 0;) {
+      std::copy(next_.begin() + (i + 1) * symbol_count_,
+                next_.begin() + (i + 2) * symbol_count_,
+                next_.begin() + i * symbol_count_);
+      size_t column = symbol_index_[static_cast<unsigned char>(content[i])];
+      next_[i * symbol_count_ + column] = static_cast<uint32_t>(i);
+    }
+  } else {
+    positions_.resize(symbol_count_);
+    for (size_t i = 0; i < length_; ++i) {
+      size_t column = symbol_index_[static_cast<unsigned char>(content[i])];
+      positions_[column].push_back(static_cast<uint32_t>(i));
+    }
+  }
+}
+
+/**
+ * @brief Busca la primera aparición de un símbolo a partir de una posición
+ * @param position Posición (desde 0) donde empieza la búsqueda
+ * @param c Símbolo buscado
+ * @return size_t Menor i >= position con s[i] == c, o npos si no existe
+ */
+size_t SubsequenceIndex::Next(size_t position, char c) const {
+  int column = symbol_index_[static_cast<unsigned char>(c)];
+  if (column == kNoSymbol || position >= length_) {
+    return npos;
+  }
+
+  if (positions_.empty()) {
+    size_t found = next_[position * symbol_count_ + column];
+    return found == length_ ? npos : found;
+  }
+
+  const std::vector<uint32_t>& list = positions_[column];
+  auto it = std::lower_bound(list.begin(), list.end(), position);
+  return it == list.end() ? npos : *it;
+}
+
+/**
+ * @brief Comprueba si una palabra es subsecuencia de la cadena indexada
+ * Empareja cada símbolo de la palabra con su primera aparición posterior
+ * a la del símbolo anterior (emparejamiento voraz, que es óptimo)
+ * @param word Palabra a comprobar
+ * @return true si los símbolos de word aparecen en s en el mismo orden
+ */
+bool SubsequenceIndex::IsSubsequence(const std::string& word) const {
+  if (word.length() > length_) {
+    return false;
+  }
+  size_t position = 0;
+  for (char c : word) {
+    size_t found = Next(position, c);
+    if (found == npos) {
+      return false;
+    }
+    position = found + 1;
+  }
+  return true;
+}
+
+/**
+ * @brief Responde un lote de consultas repartiéndolo entre varios hilos
+ * El índice es de solo lectura, por lo que los hilos lo comparten sin
+ * sincronización; cada uno escribe en un tramo distinto del resultado
+ * @param words Palabras a comprobar
+ * @return std::vector<char> 1 en la posición i si words[i] es subsecuencia
+ */
+std::vector<char> SubsequenceIndex::AreSubsequences(
+    const std::vector<std::string>& words) const {
+  std::vector<char> answers(words.size(), 0);
+  auto answer_range = [&](size_t begin, size_t end) {
+    for (size_t i = begin; i < end; ++i) {
+      answers[i] = IsSubsequence(words[i]) ? 1 : 0;
+    }
+  };
+
+  size_t thread_count =
+      std::min(HardwareThreads(), words.size() / kMinQueriesPerThread + 1);
+  if (thread_count <= 1) {
+    answer_range(0, words.size());
+    return answers;
+  }
+
+  std::vector<std::thread> workers;
+  size_t chunk = (words.size() + thread_count - 1) / thread_count;
+  for (size_t begin = 0; begin < words.size(); begin += chunk) {
+    workers.emplace_back(answer_range, begin,
+                         std::min(words.size(), begin + chunk));
+  }
+  for (auto& worker : workers) {
+    worker.join();
+  }
+  return answers;
+}
@@ -0,0 +1,98 @@
+/**
+ * @file SubsequenceIndex.h
+ * @brief Definición de la clase SubsequenceIndex para consultas de
+ * subsecuencias
+ * @author Hector Luis Mariño Fernandez
+ * @date 19 de octubre de 2026
+ */
+
+// Universidad de La Laguna
+// Escuela Superior de Ingeniería y Tecnología
+// Grado en Ingeniería Informática
+// Asignatura: Computabilidad y Algoritmia
+// Curso: 2º
+// Práctica 2: Cadenas y lenguajes
+// Autor: Hector Luis Mariño Fernandez
+// Correo: alu0100595604@ull.edu.es
+// Fecha: 19/10/2026
+// Archivo SubsequenceIndex.h: definición de la clase SubsequenceIndex.
+// Contiene un índice de siguiente aparición sobre una cadena que responde
+// si una palabra es subsecuencia suya sin generar el lenguaje completo
+// Referencias:
+// https://en.wikipedia.org/wiki/Subsequence
+//
+// Historial de revisiones
+// 19/10/2026 - Creación (primera versión) del código
+
+#ifndef SUBSEQUENCEINDEX_H
+#define SUBSEQUENCEINDEX_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "String.h"
+
+/**
+ * @brief Índice de siguiente aparición para consultas de subsecuencias
+ *
+ * Se construye una vez a partir de una cadena s y responde a la pregunta
+ * "¿es w subsecuencia de s?" sin recorrer s. Si la tabla completa de
+ * siguientes apariciones ((n + 1) x |Σ|) cabe en el presupuesto, cada consulta
+ * cuesta O(|w|); en caso contrario se guardan solo las posiciones de cada
+ * símbolo y cada paso se resuelve con una búsqueda binaria, O(|w| log n).
+ */
+class SubsequenceIndex {
+ public:
+  /// Valor devuelto por Next() cuando el símbolo no vuelve a aparecer
+  static constexpr size_t npos = static_cast<size_t>(-1);
+
+  /// Entradas máximas de la tabla completa antes de usar listas de posiciones
+  static constexpr size_t kMaxTableEntries = size_t{1} << 24;
+
+  // ==================== CONSTRUCTORES ====================
+
+  /**
+   * @brief Construye el índice sobre el contenido de una cadena
+   * @param str Cadena sobre la que se harán las consultas
+   */
+  explicit SubsequenceIndex(const String& str);
+
+  // ==================== MÉTODOS DE CONSULTA ====================
+
+  /**
+   * @brief Busca la primera aparición de un símbolo a partir de una posición
+   * @param position Posición (desde 0) donde empieza la búsqueda
+   * @param c Símbolo buscado
+   * @return size_t Menor i >= position con s[i] == c, o npos si no existe
+   */
+  size_t Next(size_t position, char c) const;
+
+  /**
+   * @brief Comprueba si una palabra es subsecuencia de la cadena indexada
+   * @param word Palabra a comprobar
+   * @return true si los símbolos de word aparecen en s en el mismo orden
+   */
+  bool IsSubsequence(const std::string& word) const;
+
+  /**
+   * @brief Responde un lote de consultas repartiéndolo entre varios hilos
+   * @param words Palabras a comprobar
+   * @return std::vector<char> 1 en la posición i si words[i] es subsecuencia
+   */
+  std::vector<char> AreSubsequences(
+      const std::vector<std::string>& words) const;
+
+ private:
+  static constexpr int kNoSymbol = -1;  ///< Símbolo ausente en la cadena
+
+  size_t length_ = 0;                  ///< Longitud de la cadena indexada
+  std::array<int, 256> symbol_index_;  ///< Byte -> columna de la tabla
+  size_t symbol_count_ = 0;            ///< Símbolos distintos de la cadena
+  std::vector<uint32_t> next_;  ///< Tabla (n + 1) x |Σ| de siguientes
+  std::vector<std::vector<uint32_t>> positions_;  ///< Posiciones por símbolo
+};
+
+#endif
@@ -0,0 +1,352 @@
+/**
+ * @file SuffixAutomaton.cc
+ * @brief Implementación de la clase SuffixAutomaton
+ * @author Hector Luis Mariño Fernandez
+ * @date 19 de octubre de 2026
+ */
+
+// Universidad de La Laguna
+// Escuela Superior de Ingeniería y Tecnología
+// Grado en Ingeniería Informática
+// Asignatura: Computabilidad y Algoritmia
+// Curso: 2º
+// Práctica 2: Cadenas y lenguajes
+// Autor: Hector Luis Mariño Fernandez
+// Correo: alu0100595604@ull.edu.es
+// Fecha: 19/10/2026
+// Archivo SuffixAutomaton.cc: implementación de la clase SuffixAutomaton.
+// Contiene la construcción del autómata generalizado, el recorrido del
+// árbol de enlaces de sufijo y las consultas entre líneas
+// Referencias:
+// https://en.wikipedia.org/wiki/Suffix_automaton
+//
+// Historial de revisiones
+// 19/10/2026 - Creación (primera versión) del código
+
+#include "SuffixAutomaton.h"
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+namespace {
+
+/// Longitud total máxima del lote; los estados se indexan con 32 bits y
+/// el autómata tiene como mucho el doble de estados que símbolos
+constexpr size_t kMaxTotalLength = std::numeric_limits<uint32_t>::max() / 2;
+
+}  // namespace
+
+/**
+ * @brief Construye el autómata sobre todas las cadenas del lote
+ * Cada línea se inserta empezando desde el estado inicial. Después se
+ * cuentan las líneas de cada estado subiendo por los enlaces de sufijo desde
+ * los estados de los prefijos de cada línea, deteniéndose en el primer
+ * estado ya marcado con esa línea, y se numera el árbol de enlaces en
+ * profundidad para poder listar las líneas de cualquier estado
+ * @param strings Cadenas del lote; la línea i es strings[i]
+ */
+SuffixAutomaton::SuffixAutomaton(const std::vector<String>& strings) {
+  size_t total_length = 0;
+  lines_.reserve(strings.size());
+  for (const String& str : strings) {
+    lines_.emplace_back(str.View());
+    total_length += lines_.back().length();
+  }
+  if (total_length > kMaxTotalLength) {
+    throw std::runtime_error(
+        "El lote es demasiado grande para el autómata de sufijos");
+  }
+
+  states_.reserve(2 * total_length + 1);
+  states_.emplace_back();
+
+  // Estado de cada prefijo no vacío, línea a línea
+  std::vector<uint32_t> prefix_states;
+  prefix_states.reserve(total_length);
+  for (const std::string& line : lines_) {
+    size_t last = 0;
+    for (char c : line) {
+      last = Extend(last, c);
+      prefix_states.push_back(static_cast<uint32_t>(last));
+    }
+  }
+
+  size_t position = 0;
+  for (size_t line = 0; line < lines_.size(); ++line) {
+    for (size_t i = 0; i < lines_[line].length(); ++i) {
+      size_t state = prefix_states[position++];
+      while (state != 0 && states_[state].last_line != line + 1) {
+        states_[state].last_line = line + 1;
+        ++states_[state].line_count;
+        state = static_cast<size_t>(states_[state].link);
+      }
+    }
+  }
+  states_[0].line_count = lines_.size();
+
+  // Recorrido en profundidad del árbol de enlaces de sufijo
+  std::vector<uint32_t> child_start(states_.size() + 1, 0);
+  for (size_t state = 1; state < states_.size(); ++state) {
+    ++child_start[states_[state].link + 1];
+  }
+  for (size_t state = 0; state < states_.size(); ++state) {
+    child_start[state + 1] += child_start[state];
+  }
+  std::vector<uint32_t> children(states_.size() - 1);
+  std::vector<uint32_t> fill(child_start.begin(), child_start.end() - 1);
+  for (size_t state = 1; state < states_.size(); ++state) {
+    children[fill[states_[state].link]++] = static_cast<uint32_t>(state);
+  }
+
+  uint32_t counter = 0;
+  std::vector<std::pair<uint32_t, uint32_t>> stack = {{0, 0}};
+  states_[0].enter = counter++;
+  while (!stack.empty()) {
+    auto& [state, child] = stack.back();
+    if (child_start[state] + child < child_start[state + 1]) {
+      uint32_t next = children[child_start[state] + child++];
+      states_[next].enter = counter++;
+      stack.push_back({next, 0});
+    } else {
+      states_[state].exit = counter;
+      stack.pop_back();
+    }
+  }
+
+  prefixes_.reserve(total_length);
+  line_entries_.resize(lines_.size());
+  position = 0;
+  for (size_t line = 0; line < lines_.size(); ++line) {
+    std::vector<uint32_t>& entries = line_entries_[line];
+    entries.reserve(lines_[line].length());
+    for (size_t i = 0; i < lines_[line].length(); ++i) {
+      uint32_t enter = states_[prefix_states[position++]].enter;
+      prefixes_.push_back({enter, static_cast<uint32_t>(line)});
+      entries.push_back(enter);
+    }
+    std::sort(entries.begin(), entries.end());
+  }
+  std::sort(prefixes_.begin(), prefixes_.end());
+}
+
+/**
+ * @brief Cuenta las líneas distintas que contienen una palabra
+ * @param word Palabra a buscar
+ * @return size_t Número de líneas que la contienen
+ */
+size_t SuffixAutomaton::LineCount(std::string_view word) const {
+  int64_t state = Walk(word);
+  return state == -1 ? 0 : states_[state].line_count;
+}
+
+/**
+ * @brief Obtiene las líneas que contienen una palabra
+ * Son las líneas de los prefijos cuyo estado cae en el subárbol del estado
+ * de la palabra, es decir, con entrada en [enter, exit)
+ * @param word Palabra a buscar
+ * @return std::vector<size_t> Líneas (desde 0) que la contienen, en orden
+ */
+std::vector<size_t> SuffixAutomaton::Lines(std::string_view word) const {
+  std::vector<size_t> lines;
+  int64_t state = Walk(word);
+  if (state == -1) {
+    return lines;
+  }
+  if (state == 0) {
+    for (size_t line = 0; line < lines_.size(); ++line) {
+      lines.push_back(line);
+    }
+    return lines;
+  }
+
+  lines.reserve(states_[state].line_count);
+  auto first = std::lower_bound(
+      prefixes_.begin(), prefixes_.end(),
+      std::make_pair(states_[state].enter, uint32_t{0}));
+  for (auto it = first;
+       it != prefixes_.end() && it->first < states_[state].exit; ++it) {
+    lines.push_back(it->second);
+  }
+  std::sort(lines.begin(), lines.end());
+  lines.erase(std::unique(lines.begin(), lines.end()), lines.end());
+  return lines;
+}
+
+/**
+ * @brief Calcula la subcadena común más larga de dos líneas
+ * Recorre la segunda línea por el autómata manteniendo la coincidencia más
+ * larga que termina en cada posición, pero solo a través de estados que
+ * aparecen en la primera línea. Como las líneas de un estado incluyen las de
+ * sus descendientes, al fallar basta con seguir el enlace de sufijo
+ * @param first Primera línea (desde 0)
+ * @param second Segunda línea (desde 0)
+ * @return std::string Subcadena común más larga; la que antes aparece en la
+ * segunda línea si hay varias
+ */
+std::string SuffixAutomaton::LongestCommonSubstring(size_t first,
+                                                    size_t second) const {
+  const std::string& text = lines_.at(second);
+  if (first >= lines_.size()) {
+    throw std::out_of_range("Línea fuera de rango");
+  }
+
+  size_t state = 0;
+  size_t length = 0;
+  size_t best_length = 0;
+  size_t best_end = 0;
+  for (size_t i = 0; i < text.length(); ++i) {
+    int64_t next = Next(state, text[i]);
+    while (state != 0 && (next == -1 || !InLine(next, first))) {
+      state = static_cast<size_t>(states_[state].link);
+      length = states_[state].length;
+      next = Next(state, text[i]);
+    }
+    if (next != -1 && InLine(next, first)) {
+      state = static_cast<size_t>(next);
+      ++length;
+    } else {
+      length = 0;
+    }
+    if (length > best_length) {
+      best_length = length;
+      best_end = i + 1;
+    }
+  }
+  return text.substr(best_end - best_length, best_length);
+}
+
+/**
+ * @brief Busca la transición de un estado con un símbolo
+ * Las transiciones de cada estado son pocas (como mucho el tamaño del
+ * alfabeto), así que una búsqueda lineal es más rápida que un mapa
+ * @param state Estado de partida
+ * @param c Símbolo
+ * @return int64_t Estado destino, o -1 si no hay transición
+ */
+int64_t SuffixAutomaton::Next(size_t state, char c) const {
+  for (const auto& [symbol, target] : states_[state].next) {
+    if (symbol == c) {
+      return target;
+    }
+  }
+  return -1;
+}
+
+/**
+ * @brief Fija la transición de un estado con un símbolo
+ * @param state Estado de partida
+ * @param c Símbolo
+ * @param target Estado destino
+ */
+void SuffixAutomaton::SetNext(size_t state, char c, size_t target) {
+  for (auto& [symbol, destination] : states_[state].next) {
+    if (symbol == c) {
+      destination = static_cast<uint32_t>(target);
+      return;
+    }
+  }
+  states_[state].next.push_back({c, static_cast<uint32_t>(target)});
+}
+
+/**
+ * @brief Añade un símbolo a continuación de un estado
+ * Es la extensión clásica del autómata de sufijos con el caso adicional de
+ * la versión generalizada: si la transición ya existe (la cadena apareció en
+ * una línea anterior) no se crea estado nuevo, aunque puede hacer falta
+ * clonar el destino para que su longitud sea la de la cadena leída
+ * @param last Estado de la cadena leída hasta ahora en la línea actual
+ * @param c Símbolo añadido
+ * @return size_t Estado de la cadena resultante
+ */
+size_t SuffixAutomaton::Extend(size_t last, char c) {
+  int64_t existing = Next(last, c);
+  if (existing != -1) {
+    size_t target = static_cast<size_t>(existing);
+    if (states_[last].length + 1 == states_[target].length) {
+      return target;
+    }
+    size_t clone = Clone(target, states_[last].length + 1);
+    for (int64_t p = static_cast<int64_t>(last);
+         p != -1 && Next(p, c) == existing; p = states_[p].link) {
+      SetNext(p, c, clone);
+    }
+    states_[target].link = static_cast<int64_t>(clone);
+    return clone;
+  }
+
+  size_t current = states_.size();
+  states_.emplace_back();
+  states_[current].length = states_[last].length + 1;
+
+  int64_t p = static_cast<int64_t>(last);
+  while (p != -1 && Next(p, c) == -1) {
+    SetNext(p, c, current);
+    p = states_[p].link;
+  }
+  if (p == -1) {
+    states_[current].link = 0;
+    return current;
+  }
+
+  int64_t target = Next(p, c);
+  if (states_[p].length + 1 == states_[target].length) {
+    states_[current].link = target;
+    return current;
+  }
+
+  size_t clone = Clone(target, states_[p].length + 1);
+  for (; p != -1 && Next(p, c) == target; p = states_[p].link) {
+    SetNext(p, c, clone);
+  }
+  states_[target].link = static_cast<int64_t>(clone);
+  states_[current].link = static_cast<int64_t>(clone);
+  return current;
+}
+
+/**
+ * @brief Copia un estado con una longitud menor para separar sus finales
+ * @param state Estado a copiar
+ * @param length Longitud del clon
+ * @return size_t Índice del clon
+ */
+size_t SuffixAutomaton::Clone(size_t state, size_t length) {
+  size_t clone = states_.size();
+  states_.push_back(states_[state]);
+  states_[clone].length = length;
+  return clone;
+}
+
+/**
+ * @brief Recorre el autómata leyendo una palabra desde el estado inicial
+ * @param word Palabra a leer
+ * @return int64_t Estado alcanzado, o -1 si la palabra no es subcadena
+ */
+int64_t SuffixAutomaton::Walk(std::string_view word) const {
+  int64_t state = 0;
+  for (char c : word) {
+    state = Next(state, c);
+    if (state == -1) {
+      return -1;
+    }
+  }
+  return state;
+}
+
+/**
+ * @brief Comprueba si las subcadenas de un estado aparecen en una línea
+ * Busca algún prefijo de la línea cuyo estado esté en el subárbol del
+ * estado dado
+ * @param state Estado
+ * @param line Línea (desde 0)
+ * @return true si alguna aparición del estado termina en esa línea
+ */
+bool SuffixAutomaton::InLine(size_t state, size_t line) const {
+  if (state == 0) {
+    return true;
+  }
+  const std::vector<uint32_t>& entries = line_entries_[line];
+  auto it = std::lower_bound(entries.begin(), entries.end(),
+                             states_[state].enter);
+  return it != entries.end() && *it < states_[state].exit;
+}
@@ -0,0 +1,153 @@
+/**
+ * @file SuffixAutomaton.h
+ * @brief Definición de la clase SuffixAutomaton, índice de subcadenas del lote
+ * @author Hector Luis Mariño Fernandez
+ * @date 19 de octubre de 2026
+ */
+
+// Universidad de La Laguna
+// Escuela Superior de Ingeniería y Tecnología
+// Grado en Ingeniería Informática
+// Asignatura: Computabilidad y Algoritmia
+// Curso: 2º
+// Práctica 2: Cadenas y lenguajes
+// Autor: Hector Luis Mariño Fernandez
+// Correo: alu0100595604@ull.edu.es
+// Fecha: 19/10/2026
+// Archivo SuffixAutomaton.h: definición de la clase SuffixAutomaton.
+// Contiene el autómata de sufijos generalizado sobre todas las cadenas
+// del lote, que responde consultas de subcadenas entre líneas
+// Referencias:
+// https://en.wikipedia.org/wiki/Suffix_automaton
+//
+// Historial de revisiones
+// 19/10/2026 - Creación (primera versión) del código
+
+#ifndef SUFFIXAUTOMATON_H
+#define SUFFIXAUTOMATON_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "String.h"
+
+/**
+ * @brief Autómata de sufijos generalizado sobre un lote de cadenas
+ *
+ * Reconoce exactamente las subcadenas de alguna de las cadenas del lote y
+ * se construye en tiempo lineal en la longitud total. Cada estado agrupa
+ * subcadenas con el mismo conjunto de finales, así que todas aparecen en
+ * las mismas líneas. Para saber cuáles se usa el árbol de enlaces de
+ * sufijo: las líneas de un estado son las de los prefijos que caen en su
+ * subárbol, que ocupa un intervalo contiguo en un recorrido en profundidad.
+ */
+class SuffixAutomaton {
+ public:
+  // ==================== CONSTRUCTORES ====================
+
+  /**
+   * @brief Construye el autómata sobre todas las cadenas del lote
+   * @param strings Cadenas del lote; la línea i es strings[i]
+   */
+  explicit SuffixAutomaton(const std::vector<String>& strings);
+
+  // ==================== MÉTODOS DE CONSULTA ====================
+
+  /**
+   * @brief Cuenta las líneas distintas que contienen una palabra
+   * @param word Palabra a buscar
+   * @return size_t Número de líneas que la contienen
+   */
+  size_t LineCount(std::string_view word) const;
+
+  /**
+   * @brief Obtiene las líneas que contienen una palabra
+   * @param word Palabra a buscar
+   * @return std::vector<size_t> Líneas (desde 0) que la contienen, en orden
+   */
+  std::vector<size_t> Lines(std::string_view word) const;
+
+  /**
+   * @brief Calcula la subcadena común más larga de dos líneas
+   * @param first Primera línea (desde 0)
+   * @param second Segunda línea (desde 0)
+   * @return std::string Subcadena común más larga; la que antes aparece en la
+   * segunda línea si hay varias
+   */
+  std::string LongestCommonSubstring(size_t first, size_t second) const;
+
+ private:
+  /**
+   * @brief Estado del autómata
+   */
+  struct State {
+    size_t length = 0;       ///< Longitud de la subcadena más larga
+    int64_t link = -1;       ///< Enlace de sufijo, -1 en el estado inicial
+    std::vector<std::pair<char, uint32_t>> next;  ///< Transiciones
+    size_t line_count = 0;   ///< Líneas distintas que contienen el estado
+    size_t last_line = 0;    ///< Última línea contada (uso interno)
+    uint32_t enter = 0;      ///< Entrada en el recorrido del árbol de enlaces
+    uint32_t exit = 0;       ///< Salida en el recorrido del árbol de enlaces
+  };
+
+  std::vector<std::string> lines_;  ///< Contenido de cada línea
+  std::vector<State> states_;       ///< Estados; el 0 es el inicial
+  /// Prefijos de todas las líneas como (entrada de su estado, línea),
+  /// ordenados por entrada
+  std::vector<std::pair<uint32_t, uint32_t>> prefixes_;
+  /// Entradas de los estados de los prefijos de cada línea, ordenadas
+  std::vector<std::vector<uint32_t>> line_entries_;
+
+  /**
+   * @brief Busca la transición de un estado con un símbolo
+   * @param state Estado de partida
+   * @param c Símbolo
+   * @return int64_t Estado destino, o -1 si no hay transición
+   */
+  int64_t Next(size_t state, char c) const;
+
+  /**
+   * @brief Fija la transición de un estado con un símbolo
+   * @param state Estado de partida
+   * @param c Símbolo
+   * @param target Estado destino
+   */
+  void SetNext(size_t state, char c, size_t target);
+
+  /**
+   * @brief Añade un símbolo a continuación de un estado
+   * @param last Estado de la cadena leída hasta ahora en la línea actual
+   * @param c Símbolo añadido
+   * @return size_t Estado de la cadena resultante
+   */
+  size_t Extend(size_t last, char c);
+
+  /**
+   * @brief Copia un estado con una longitud menor para separar sus finales
+   * @param state Estado a copiar
+   * @param length Longitud del clon
+   * @return size_t Índice del clon
+   */
+  size_t Clone(size_t state, size_t length);
+
+  /**
+   * @brief Recorre el autómata leyendo una palabra desde el estado inicial
+   * @param word Palabra a leer
+   * @return int64_t Estado alcanzado, o -1 si la palabra no es subcadena
+   */
+  int64_t Walk(std::string_view word) const;
+
+  /**
+   * @brief Comprueba si las subcadenas de un estado aparecen en una línea
+   * @param state Estado
+   * @param line Línea (desde 0)
+   * @return true si alguna aparición del estado termina en esa línea
+   */
+  bool InLine(size_t state, size_t line) const;
+};
+
+#endif